@@ -0,0 +1,204 @@
+#include <vector>
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+#include "TFile.h"
+#include "TTree.h"
+#include "TString.h"
+#include "TSystem.h"
+#include "TRandom3.h"
+#include "TStopwatch.h"
+
+#include "HiggsAnalysis/HiggsToTauTau/interface/PlotLimits.h"
+
+/// write a combine like output file with one entry per value of quantiles
+void writeLimit(const char* fullpath, float mass, const std::vector<float>& quantiles, double median, TRandom3& rnd)
+{
+  TFile* file = new TFile(fullpath, "recreate");
+  // combine writes more branches than the ones that are read by PlotLimits
+  double limit, mh; float quantileExpected, t_cpu; int iToy;
+  TTree* tree = new TTree("limit", "limit");
+  tree->Branch("limit", &limit, "limit/D");
+  tree->Branch("mh", &mh, "mh/D");
+  tree->Branch("iToy", &iToy, "iToy/I");
+  tree->Branch("t_cpu", &t_cpu, "t_cpu/F");
+  tree->Branch("quantileExpected", &quantileExpected, "quantileExpected/F");
+  for(unsigned int i=0; i<quantiles.size(); ++i){
+    // rough shape of an expected band around the median
+    limit = quantiles[i]<0 ? median*rnd.Gaus(1., 0.2) : median*exp(1.5*0.3*(quantiles[i]-0.5));
+    mh = mass; iToy = 0; t_cpu = rnd.Uniform(); quantileExpected = quantiles[i];
+    tree->Fill();
+  }
+  file->cd(); tree->Write(); file->Close();
+  delete file;
+}
+
+/// write a batch_collected file with ntoys toy limits
+void writeToys(const char* fullpath, float mass, unsigned int ntoys, double median, TRandom3& rnd)
+{
+  TFile* file = new TFile(fullpath, "recreate");
+  double limit, mh; float quantileExpected, t_cpu; int iToy;
+  TTree* tree = new TTree("limit", "limit");
+  tree->Branch("limit", &limit, "limit/D");
+  tree->Branch("mh", &mh, "mh/D");
+  tree->Branch("iToy", &iToy, "iToy/I");
+  tree->Branch("t_cpu", &t_cpu, "t_cpu/F");
+  tree->Branch("quantileExpected", &quantileExpected, "quantileExpected/F");
+  for(unsigned int i=0; i<ntoys; ++i){
+    limit = median*exp(rnd.Gaus(0., 0.3));
+    mh = mass; iToy = i; t_cpu = rnd.Uniform(); quantileExpected = -1;
+    tree->Fill();
+  }
+  file->cd(); tree->Write(); file->Close();
+  delete file;
+}
+
+/// generate a limit directory with masses.size() mass points, as expected by PlotLimits
+void generate(const char* directory, const std::vector<double>& masses, unsigned int ntoys, const std::vector<float>& quantiles, const char* label)
+{
+  TRandom3 rnd(4357);
+  // quantiles of the HybridNew output files as expected by PlotLimits::fillBand
+  const char* cls[] = {"", ".quant0.027", ".quant0.160", ".quant0.500", ".quant0.840", ".quant0.975"};
+  std::vector<float> observed(1, -1.), all(quantiles); all.push_back(-1.);
+  for(std::vector<double>::const_iterator mass=masses.begin(); mass!=masses.end(); ++mass){
+    gSystem->mkdir(TString::Format("%s/%d", directory, (int)*mass), true);
+    double median = 0.5+1.5*rnd.Uniform();
+    writeLimit(TString::Format("%s/%d/higgsCombine-obs.Asymptotic.mH%d.root", directory, (int)*mass, (int)*mass), *mass, all, median, rnd);
+    writeLimit(TString::Format("%s/%d/higgsCombine-exp.Asymptotic.mH%d.root", directory, (int)*mass, (int)*mass), *mass, all, median, rnd);
+    for(unsigned int icls=0; icls<sizeof(cls)/sizeof(cls[0]); ++icls){
+      writeLimit(TString::Format("%s/%d/higgsCombineTest.HybridNew.mH%d%s.root", directory, (int)*mass, (int)*mass, cls[icls]), *mass, observed, median, rnd);
+    }
+    writeToys(TString::Format("%s/%d/batch_collected_%s.root", directory, (int)*mass, label), *mass, ntoys, median, rnd);
+  }
+}
+
+/// peak resident set size of the process in kB; this is a high-water mark of the whole process,
+/// therefore each run is executed in a process of its own (see isolated)
+long peakRSS()
+{
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+/// fill observed, expected and both bands for one limit type with a fresh buffer and report the cost
+void run(const char* name, const char* directory, const edm::ParameterSet& layout, const char* observed, const char* expected, const char* band)
+{
+  LimitCache cache;
+  PlotLimits plot("benchmark", layout, &cache);
+  Long64_t bytes = TFile::GetFileBytesRead();
+  TStopwatch watch; watch.Start();
+  TGraph* obs = new TGraph();
+  if(observed){ plot.fillCentral(directory, obs, observed); }
+  TGraph* central = new TGraph();
+  plot.fillCentral(directory, central, expected);
+  TGraphAsymmErrors* inner = new TGraphAsymmErrors();
+  plot.fillBand(directory, inner, band, true);
+  TGraphAsymmErrors* outer = new TGraphAsymmErrors();
+  plot.fillBand(directory, outer, band, false);
+  watch.Stop();
+  std::cout << std::setw(12) << std::left << name
+	    << " points = " << std::setw(5) << central->GetN()
+	    << " files opened = " << std::setw(6) << cache.opened()
+	    << " bytes read = " << std::setw(12) << TFile::GetFileBytesRead()-bytes
+	    << " wall time = " << std::setw(8) << watch.RealTime() << " s"
+	    << " peak RSS = " << peakRSS() << " kB" << std::endl;
+  delete obs; delete central; delete inner; delete outer;
+}
+
+/// execute run in a forked child process, such that the peak RSS of each limit type does not
+/// include the memory of the limit types that were run before; it still includes the memory that
+/// the process held at the time of the fork
+void isolated(const char* name, const char* directory, const edm::ParameterSet& layout, const char* observed, const char* expected, const char* band)
+{
+  std::cout.flush();
+  pid_t pid = fork();
+  if(pid<0){
+    std::cout << "WARNING: could not fork, peak RSS includes all previous runs" << std::endl;
+    run(name, directory, layout, observed, expected, band);
+    return;
+  }
+  if(pid==0){
+    run(name, directory, layout, observed, expected, band);
+    std::cout.flush();
+    // skip the exit handlers of the parent process
+    _exit(0);
+  }
+  int status;
+  waitpid(pid, &status, 0);
+  if(!WIFEXITED(status) || WEXITSTATUS(status)!=0){
+    std::cout << "ERROR: run " << name << " failed" << std::endl;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  // parse arguments
+  if( argc < 2 ){
+    std::cout << "Usage : " << argv[0] << " [target-dir] [option1=value1 [option2=value2] ...]                    \n "
+	      << " Generates a limit directory with synthetic combine output files and measures the cost of   \n "
+	      << " PlotLimits::fillCentral and PlotLimits::fillBand for asymptotic, CLs and toy based limits.  \n "
+	      << " Possible options are:                                                                       \n "
+	      << "            - masses=20       : number of mass points (starting at 90 GeV in steps of 10 GeV)\n "
+	      << "            - toys=1000       : number of toys per mass point                                \n "
+	      << "            - quantiles=0.025,0.16,0.5,0.84,0.975 : quantiles of the asymptotic output files  \n "
+	      << "            - threads=1       : number of threads to read the mass points                    \n "
+	      << "            - toySketch=0     : number of toys above which quantiles are estimated           \n "
+	      << "            - generate=1      : generate the input files (0: use existing files)             \n "
+	      << "example: " << argv[0] << " /tmp/benchmark masses=90 toys=10000 threads=4" << std::endl;
+    return 0;
+  }
+  unsigned int nmasses=20, ntoys=1000, threads=1, toySketch=0; bool create=true;
+  std::vector<float> quantiles;
+  for(int i=2; i<argc; ++i){
+    std::string argument(argv[i]);
+    std::string key = argument.substr(0, argument.find("="));
+    std::string value = argument.substr(argument.find("=")+1);
+    if(key==std::string("masses"   )){ nmasses   = atoi(value.c_str()); }
+    else if(key==std::string("toys"     )){ ntoys     = atoi(value.c_str()); }
+    else if(key==std::string("threads"  )){ threads   = atoi(value.c_str()); }
+    else if(key==std::string("toySketch")){ toySketch = atoi(value.c_str()); }
+    else if(key==std::string("generate" )){ create    = atoi(value.c_str()); }
+    else if(key==std::string("quantiles")){
+      std::stringstream stream(value); std::string q;
+      while(std::getline(stream, q, ',')){ quantiles.push_back(atof(q.c_str())); }
+    }
+    else{
+      std::cout << "ERROR: unknown option: " << argument << std::endl;
+      return 1;
+    }
+  }
+  if(quantiles.empty()){
+    quantiles.push_back(0.025); quantiles.push_back(0.16); quantiles.push_back(0.5); quantiles.push_back(0.84); quantiles.push_back(0.975);
+  }
+  std::vector<double> masses;
+  for(unsigned int imass=0; imass<nmasses; ++imass){ masses.push_back(90.+10.*imass); }
+  /*
+    Implementation
+  */
+  std::string label("benchmark");
+  if(create){
+    TStopwatch watch; watch.Start();
+    generate(argv[1], masses, ntoys, quantiles, label.c_str());
+    watch.Stop();
+    std::cout << "generated " << nmasses << " mass points with " << ntoys << " toys in " << watch.RealTime() << " s" << std::endl;
+  }
+  // minimal layout, no output is written
+  edm::ParameterSet layout;
+  layout.addParameter<std::string>("dataset", "benchmark");
+  layout.addParameter<std::string>("xaxis", "m_{H} [GeV]");
+  layout.addParameter<std::string>("yaxis", "95% CL limit");
+  layout.addParameter<std::string>("outputLabel", label);
+  layout.addParameter<std::vector<double> >("masspoints", masses);
+  layout.addParameter<unsigned int>("threads", threads);
+  layout.addParameter<unsigned int>("toySketch", toySketch);
+  isolated("asymptotic", argv[1], layout, "higgsCombine-obs.Asymptotic.mH$MASS", "higgsCombine-exp.Asymptotic.mH$MASS", "higgsCombine-exp.Asymptotic.mH$MASS");
+  isolated("CLs"       , argv[1], layout, "higgsCombineTest.HybridNew.mH$MASS", "higgsCombineTest.HybridNew.mH$MASS.quant0.500", "CLs");
+  isolated("toys"      , argv[1], layout, 0, "MEDIAN", "TOYBASED");
+  return 0;
+}
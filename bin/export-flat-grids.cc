@@ -0,0 +1,122 @@
+#include <string>
+#include <vector>
+#include <stdlib.h>
+#include <iostream>
+
+#include "TH2.h"
+#include "TKey.h"
+#include "TFile.h"
+#include "TList.h"
+#include "TAxis.h"
+#include "TTree.h"
+#include "TString.h"
+#include "HiggsAnalysis/HiggsToTauTau/interface/FlatGrid.h"
+#include "HiggsAnalysis/HiggsToTauTau/interface/FeynHiggsScan.h"
+
+/// append the grids of all trees in the FeynHiggs scan file input to grids
+bool feynHiggs(const char* input, unsigned int n_tanb, double min_tanb, double max_tanb, unsigned int n_mA, double min_mA, double max_mA, std::vector<FlatGrid::Grid>& grids)
+{
+  std::vector<std::string> trees;
+  TFile* file = TFile::Open(input);
+  if( !file ){
+    return false;
+  }
+  TIter next(file->GetListOfKeys());
+  while( TKey* key = (TKey*)next() ){
+    if( std::string(key->GetClassName())=="TTree" ){
+      trees.push_back(key->GetName());
+    }
+  }
+  file->Close();
+  for(std::vector<std::string>::const_iterator tree=trees.begin(); tree!=trees.end(); ++tree){
+    FeynHiggsScan scan(input, tree->c_str(), n_tanb, min_tanb, max_tanb, n_mA, min_mA, max_mA);
+    if( !scan.isOpen() ){
+      return false;
+    }
+    scan.load(scan.variables());
+    if( !scan.flatten(grids, *tree) ){
+      return false;
+    }
+    std::cout << "tree   = " << *tree << std::endl;
+  }
+  return !trees.empty();
+}
+
+/// append all TH2 in the mssm_xs_tools input file input to grids; fails if any of them has variable
+/// bin sizes, as it could not be written to the flat file and mssm_xs_tools would return 0 for it
+bool mssmXS(const char* input, std::vector<FlatGrid::Grid>& grids)
+{
+  TFile* file = TFile::Open(input);
+  if( !file ){
+    return false;
+  }
+  bool success = true;
+  TIter next(file->GetListOfKeys());
+  while( TKey* key = (TKey*)next() ){
+    // each object is deleted after its values have been copied, such that only a single histogram is
+    // resident at a time
+    TObject* obj = key->ReadObj();
+    TH2* hist = dynamic_cast<TH2*>(obj);
+    if( !hist ){
+      delete obj;
+      continue;
+    }
+    TAxis* xaxis = hist->GetXaxis(); TAxis* yaxis = hist->GetYaxis();
+    if( xaxis->IsVariableBinSize() || yaxis->IsVariableBinSize() ){
+      std::cout << "ERROR: histogram " << hist->GetName() << " has variable bin sizes and cannot be written to a flat file" << std::endl;
+      delete obj;
+      success = false;
+      break;
+    }
+    FlatGrid::Grid grid;
+    grid.name = hist->GetName();
+    grid.nx = xaxis->GetNbins(); grid.xmin = xaxis->GetXmin(); grid.xmax = xaxis->GetXmax();
+    grid.ny = yaxis->GetNbins(); grid.ymin = yaxis->GetXmin(); grid.ymax = yaxis->GetXmax();
+    for(unsigned int ix=1; ix<=grid.nx; ++ix){
+      for(unsigned int iy=1; iy<=grid.ny; ++iy){
+        grid.values.push_back(hist->GetBinContent(ix, iy));
+      }
+    }
+    grids.push_back(grid);
+    delete obj;
+  }
+  file->Close();
+  delete file;
+  return success && !grids.empty();
+}
+
+int main(int argc, char* argv[])
+{
+  // parse arguments
+  if( argc < 4 || (std::string(argv[1])=="feyn-higgs" && argc < 10) ){
+    std::cout << "Usage : " << argv[0] << " [type] [input] [output] [n_tanb min_tanb max_tanb n_mA min_mA max_mA]\n"
+	      << " [type] : 'feyn-higgs' for the FeynHiggs scan files (all trees of the file are exported; the grid\n"
+	      << "          parameters are the same as for the class FeynHiggsScan) or 'mssm-xs' for the input files\n"
+	      << "          of mssm_xs_tools (all 2d histograms of the file are exported; histograms with variable bin\n"
+	      << "          sizes cannot be exported and make the export fail).\n example: "
+	      << argv[0] << " feyn-higgs data/feyn-higgs-mssm-scan-mhmax-7TeV-fine.root data/feyn-higgs-mssm-scan-mhmax-7TeV-fine.flat 90 1 10 96 50 1010\n example: "
+	      << argv[0] << " mssm-xs data/out.mhmax-mu+200-7TeV-tanbHigh-nnlo.root data/out.mhmax-mu+200-7TeV-tanbHigh-nnlo.flat" << std::endl;
+    return 0;
+  }
+  /*
+    Implementation
+  */
+  std::vector<FlatGrid::Grid> grids;
+  bool success = false;
+  if( std::string(argv[1])=="feyn-higgs" ){
+    success = feynHiggs(argv[2], atoi(argv[4]), atof(argv[5]), atof(argv[6]), atoi(argv[7]), atof(argv[8]), atof(argv[9]), grids);
+  }
+  else if( std::string(argv[1])=="mssm-xs" ){
+    success = mssmXS(argv[2], grids);
+  }
+  else{
+    std::cout << "ERROR: unknown type " << argv[1] << std::endl;
+    return 1;
+  }
+  if( !success || !FlatGrid::write(argv[3], grids) ){
+    std::cout << "ERROR: could not export " << argv[2] << " to " << argv[3] << std::endl;
+    return 1;
+  }
+  std::cout << "grids  = " << grids.size() << std::endl;
+  return 0;
+}
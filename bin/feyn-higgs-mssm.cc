@@ -1,13 +1,86 @@
+#include <map>
+#include <string>
+#include <fstream>
+#include <sstream>
 #include <stdlib.h>
 
 #include "TString.h"
 #include "HiggsAnalysis/HiggsToTauTau/interface/FeynHiggsScan.h"
 
+/// return the scan for the tanb region of tanb; each scan is only opened on first request and
+/// kept resident for all further queries. Returns 0 if the scan could not be opened
+FeynHiggsScan* scan(std::map<bool, FeynHiggsScan*>& scans, const std::string& model, const std::string& uncertainty, float tanb)
+{
+  bool fine = tanb<10;
+  std::map<bool, FeynHiggsScan*>::const_iterator buffer = scans.find(fine);
+  if( buffer!=scans.end() ){
+    return buffer->second;
+  }
+  FeynHiggsScan* scan = 0;
+  if(fine){
+    TString path = TString::Format("%s/src/HiggsAnalysis/HiggsToTauTau/data/feyn-higgs-mssm-scan-%s-fine.root", getenv("CMSSW_BASE"), model.c_str());
+    scan = new FeynHiggsScan(path, TString::Format("mssm_scan%s", uncertainty.c_str()), 90, 1., 10., 96., 50., 1010.);
+  }
+  else{
+    TString path = TString::Format("%s/src/HiggsAnalysis/HiggsToTauTau/data/feyn-higgs-mssm-scan-%s.root", getenv("CMSSW_BASE"), model.c_str());
+    scan = new FeynHiggsScan(path, TString::Format("mssm_scan%s", uncertainty.c_str()), 70, 1., 71., 96., 50., 1010.);
+  }
+  if( !scan->isOpen() ){
+    delete scan;
+    return 0;
+  }
+  // queries may ask for any variable; all grids are filled in a single pass over the tree instead
+  // of one pass per variable on its first request
+  scan->load(scan->variables());
+  scans[fine] = scan;
+  return scan;
+}
+
+/// answer queries of type 'type model process mA tanb' line by line from in. For each query one line
+/// 'type model process mA tanb mH mh value' is written to out and flushed, such that the binary can
+/// be driven through a pipe. Empty lines and lines starting with '#' are skipped. Returns false (and
+/// stops) if a scan could not be opened
+bool query(std::istream& in, std::ostream& out, const std::string& model, const std::string& uncertainty)
+{
+  std::map<bool, FeynHiggsScan*> scans;
+  std::string line;
+  bool success = true;
+  while( success && std::getline(in, line) ){
+    std::istringstream buffer(line);
+    std::string type, higgs, process; float mA, tanb;
+    if( !(buffer >> type) || type[0]=='#' ){
+      continue;
+    }
+    if( !(buffer >> higgs >> process >> mA >> tanb) ){
+      out << "ERROR: could not parse query: " << line << std::endl;
+      continue;
+    }
+    FeynHiggsScan* fh = scan(scans, model, uncertainty, tanb);
+    if( !fh ){
+      out << "ERROR: could not open scan for model " << model << " and tanb " << tanb << std::endl;
+      success = false;
+      continue;
+    }
+    out << type << " " << higgs << " " << process << " " << mA << " " << tanb << " " 
+        << fh->mH(mA, tanb) << " " << fh->mh(mA, tanb) << " " << fh->get(process.c_str(), higgs.c_str(), type.c_str(), mA, tanb) << std::endl;
+  }
+  for(std::map<bool, FeynHiggsScan*>::iterator fh=scans.begin(); fh!=scans.end(); ++fh){
+    delete fh->second;
+  }
+  return success;
+}
+
 int main(int argc, char* argv[]) 
 {
   // parse arguments
-  if( argc < 6 ){
+  bool queries = argc>1 && std::string(argv[1])=="--query";
+  if( argc < 6 && !queries ){
     std::cout << "Usage : " << argv[0] << " [type] [model] [process] [mA] [tanb] [option]       \n "
+	      << "        " << argv[0] << " --query [file] [option]                             \n "
+	      << " --query  : read queries of type '[type] [model] [process] [mA] [tanb]' line by \n "
+	      << "            line from file (or from stdin if no file or '-' is given) and write \n "
+	      << "            one line '[type] [model] [process] [mA] [tanb] [mH] [mh] [value]'  \n "
+	      << "            per query to stdout. The input files are only opened once.         \n "
 	      << " [option] : should consist of a key word and a value separated by a '='-sign. \n "
 	      << "            keywords can be 'uncertainty' or 'model'. No spaces are allowed   \n "
 	      << "            between keyword and value. Possible values for the options are:   \n "
@@ -24,17 +97,37 @@ int main(int argc, char* argv[])
 	      << " - " << argv[0] << " xs sm ggH 120 5 model=saeff-7TeV   \n ";
     return 0;
   }
+  // for --query the input file is optional, options follow directly
+  std::string file("-");
+  int iopt = 6;
+  if( queries ){
+    iopt = 2;
+    if( argc>2 && std::string(argv[2]).find("=")==std::string::npos ){
+      file = argv[2]; iopt = 3;
+    }
+  }
   std::string model("mhmax-7TeV");
-  if( argc > 6 ){
-    if( std::string(argv[6]).find("model=")!=std::string::npos ){
-      model = std::string(argv[6]).substr(std::string(argv[6]).find("=")+1);
+  if( argc > iopt ){
+    if( std::string(argv[iopt]).find("model=")!=std::string::npos ){
+      model = std::string(argv[iopt]).substr(std::string(argv[iopt]).find("=")+1);
     }
   }
   std::string uncertainty;
-  if( argc > 6 ){
-    if( std::string(argv[6]).find("uncertainty=")!=std::string::npos ){
-      uncertainty+="_"+std::string(argv[6]).substr(std::string(argv[6]).find("=")+1);
+  if( argc > iopt ){
+    if( std::string(argv[iopt]).find("uncertainty=")!=std::string::npos ){
+      uncertainty+="_"+std::string(argv[iopt]).substr(std::string(argv[iopt]).find("=")+1);
+    }
+  }
+  if( queries ){
+    if( file=="-" ){
+      return query(std::cin, std::cout, model, uncertainty) ? 0 : 1;
     }
+    std::ifstream in(file.c_str());
+    if( !in ){
+      std::cout << "ERROR: could not open file " << file << std::endl;
+      return 1;
+    }
+    return query(in, std::cout, model, uncertainty) ? 0 : 1;
   }
   /*
     Implementation
@@ -43,6 +136,12 @@ int main(int argc, char* argv[])
     TString path = TString::Format("%s/src/HiggsAnalysis/HiggsToTauTau/data/feyn-higgs-mssm-scan-%s-fine.root", getenv("CMSSW_BASE"), model.c_str());
     //std::string path(getenv("CMSSW_BASE")+std::string("/src/HiggsAnalysis/HiggsToTauTau/data/feyn-higgs-mssm-scan-mhmax-fine.root"));
     FeynHiggsScan scan(path, TString::Format("mssm_scan%s", uncertainty.c_str()), 90, 1., 10., 96., 50., 1010.);
+    if( !scan.isOpen() ){
+      return 1;
+    }
+    // read all variables of interest in a single pass
+    std::vector<std::string> vars; vars.push_back("mH"); vars.push_back("mh"); vars.push_back(FeynHiggsScan::name(argv[3], argv[2], argv[1]));
+    scan.load(vars);
     std::cout << "tanb   = " << argv[5] << std::endl;
     std::cout << "mA     = " << argv[4] << std::endl;
     std::cout << "mH     = " << scan.mH(atof(argv[4]), atof(argv[5])) << std::endl;
@@ -55,6 +154,12 @@ int main(int argc, char* argv[])
     TString path = TString::Format("%s/src/HiggsAnalysis/HiggsToTauTau/data/feyn-higgs-mssm-scan-%s.root", getenv("CMSSW_BASE"), model.c_str());
     //std::string path(getenv("CMSSW_BASE")+std::string("/src/HiggsAnalysis/HiggsToTauTau/data/feyn-higgs-mssm-scan-mhmax.root"));
     FeynHiggsScan scan(path, TString::Format("mssm_scan%s", uncertainty.c_str()), 70, 1., 71., 96., 50., 1010.);
+    if( !scan.isOpen() ){
+      return 1;
+    }
+    // read all variables of interest in a single pass
+    std::vector<std::string> vars; vars.push_back("mH"); vars.push_back("mh"); vars.push_back(FeynHiggsScan::name(argv[3], argv[2], argv[1]));
+    scan.load(vars);
     std::cout << "tanb   = " << argv[5] << std::endl;
     std::cout << "mA     = " << argv[4] << std::endl;
     std::cout << "mH     = " << scan.mH(atof(argv[4]), atof(argv[5])) << std::endl;
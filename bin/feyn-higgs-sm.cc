@@ -1,18 +1,51 @@
+#include <string>
+#include <fstream>
+#include <sstream>
 #include <stdlib.h>
 
 #include "TString.h"
 #include "HiggsAnalysis/HiggsToTauTau/interface/FeynHiggsScan.h"
 
+/// answer queries of type 'type process mH' line by line from in. For each query one line 'type
+/// process mH value' is written to out and flushed, such that the binary can be driven through a
+/// pipe. Empty lines and lines starting with '#' are skipped
+void query(std::istream& in, std::ostream& out, FeynHiggsScan& scan)
+{
+  std::string line;
+  while( std::getline(in, line) ){
+    std::istringstream buffer(line);
+    std::string type, process; float mass;
+    if( !(buffer >> type) || type[0]=='#' ){
+      continue;
+    }
+    if( !(buffer >> process >> mass) ){
+      out << "ERROR: could not parse query: " << line << std::endl;
+      continue;
+    }
+    out << type << " " << process << " " << mass << " " << scan.get(process.c_str(), "sm", type.c_str(), mass, 1.) << std::endl;
+  }
+}
+
 int main(int argc, char* argv[]) 
 {
   // parse arguments
-  if( argc < 3 ){
+  bool queries = argc>1 && std::string(argv[1])=="--query";
+  if( argc < 3 && !queries ){
     std::cout << "Usage : " << argv[0] << " [type] [process] [mH] [uncertainty]\n example: " 
-	      << argv[0] << " xs ggA 120 [mu+]" << std::endl;
+	      << argv[0] << " xs ggA 120 [mu+]\n"
+	      << "        " << argv[0] << " --query [file] [uncertainty]\n"
+	      << " --query : read queries of type '[type] [process] [mH]' line by line from file (or from\n"
+	      << "           stdin if '-' is given) and write one line '[type] [process] [mH] [value]' per\n"
+	      << "           query to stdout. The input file is only opened once." << std::endl;
     return 0;
   }
   std::string uncertainty;
-  if( argc > 4 ){
+  if( queries ){
+    if( argc > 3 ){
+      uncertainty+="_"+std::string(argv[3]);
+    }
+  }
+  else if( argc > 4 ){
     uncertainty+="_"+std::string(argv[4]);
   }
   /*
@@ -20,6 +53,27 @@ int main(int argc, char* argv[])
   */
   std::string path(getenv("CMSSW_BASE")+std::string("/src/HiggsAnalysis/HiggsToTauTau/data/feyn-higgs-sm-scan-7TeV.root"));
   FeynHiggsScan scan(path.c_str(), TString::Format("mssm_scan%s", uncertainty.c_str()), 1, 1., 2., 951, 50, 1000.);
+  if( !scan.isOpen() ){
+    return 1;
+  }
+  if( queries ){
+    // queries may ask for any variable; all grids are filled in a single pass over the tree instead
+    // of one pass per variable on its first request
+    scan.load(scan.variables());
+    std::string file(argc>2 ? argv[2] : "-");
+    if( file=="-" ){
+      query(std::cin, std::cout, scan);
+    }
+    else{
+      std::ifstream in(file.c_str());
+      if( !in ){
+        std::cout << "ERROR: could not open file " << file << std::endl;
+        return 1;
+      }
+      query(in, std::cout, scan);
+    }
+    return 0;
+  }
   std::cout << "mA     = " << argv[3] << std::endl;
   std::cout << "var    = " << argv[1] << "_sm_" << argv[2] << std::endl;
   std::cout << "value  = " << scan.get(argv[2], "sm", argv[1], atof(argv[3]), 1.) << std::endl;
@@ -0,0 +1,25 @@
+#include <stdlib.h>
+#include <iostream>
+
+#include "HiggsAnalysis/HiggsToTauTau/interface/LimitCache.h"
+
+int main(int argc, char* argv[])
+{
+  // parse arguments
+  if( argc < 2 ){
+    std::cout << "Usage : " << argv[0] << " [target-dir] [threads]\n example: "
+	      << argv[0] << " LIMITS/sm/cmb 4" << std::endl;
+    return 0;
+  }
+  unsigned int threads = 1; /// number of threads to read the mass points concurrently
+  if( argc == 3){
+    threads = atoi(argv[2]);
+  }
+  /*
+    Implementation
+  */
+  LimitCache cache(1);
+  unsigned int nfiles = cache.harvest(argv[1], threads);
+  std::cout << "files = " << nfiles << std::endl;
+  return nfiles>0 ? 0 : 1;
+}
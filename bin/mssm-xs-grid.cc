@@ -0,0 +1,203 @@
+#include <string>
+#include <vector>
+#include <stdlib.h>
+#include <iostream>
+
+#include "TH2F.h"
+#include "TFile.h"
+#include "TString.h"
+#include "TThread.h"
+#include "HiggsAnalysis/HiggsToTauTau/interface/FlatGrid.h"
+#include "HiggsAnalysis/HiggsToTauTau/macros/mssm_xs_tools.h"
+#include "HiggsAnalysis/HiggsToTauTau/macros/mssm_xs_tools.C"
+
+/// production modes, Higgs bosons and decay channels that are combined; the cross sections and
+/// branching ratios are the same as in macros/mssm_xs.C (gluon fusion and Santander matched bbPhi)
+static const char* productions[] = {"gg", "bb"};
+static const char* higgses[] = {"h", "H", "A"};
+static const char* decays[] = {"tautau", "mumu", "bb"};
+static const mssm_xs_tools::Quantity brs[3][3] = {
+  {mssm_xs_tools::k_brtautau_h, mssm_xs_tools::k_brtautau_H, mssm_xs_tools::k_brtautau_A},
+  {mssm_xs_tools::k_brmumu_h  , mssm_xs_tools::k_brmumu_H  , mssm_xs_tools::k_brmumu_A  },
+  {mssm_xs_tools::k_brbb_h    , mssm_xs_tools::k_brbb_H    , mssm_xs_tools::k_brbb_A    }
+};
+/// number of grids: xs x BR for each production, Higgs boson and decay, the sum over all Higgs
+/// bosons for each production and decay, and the masses of h and H
+static const unsigned int ngrids = 2*3*3+2*3+2;
+
+/// grid in mA and tanb with the binning of a TH2F; the values are evaluated at the bin centres
+struct Binning {
+  unsigned int n_mA; double min_mA, max_mA;
+  unsigned int n_tanb; double min_tanb, max_tanb;
+  double mA(unsigned int ix) const { return min_mA+(ix+0.5)*(max_mA-min_mA)/n_mA; }
+  double tanb(unsigned int iy) const { return min_tanb+(iy+0.5)*(max_tanb-min_tanb)/n_tanb; }
+};
+
+/// a block of rows in mA to be filled by a single thread
+struct GridJob {
+  /// tables to read from (const, shared by all threads)
+  const mssm_xs_tools::Snapshot* snapshot;
+  const Binning* binning;
+  /// first and last+1 row in mA
+  unsigned int first, last;
+  /// values of all grids (n_mA x n_tanb each, the index in tanb running fastest); each thread only
+  /// writes its own rows
+  std::vector<std::vector<float> >* values;
+};
+
+/// name of grid igrid
+std::string name(unsigned int igrid)
+{
+  if( igrid<18 ){
+    return std::string(productions[igrid/9])+higgses[igrid%3]+"_"+decays[igrid/3%3];
+  }
+  if( igrid<24 ){
+    return std::string(productions[(igrid-18)/3])+"Phi_"+decays[(igrid-18)%3];
+  }
+  return igrid==24 ? "mh" : "mH";
+}
+
+/// fill all grids at a single point; units are pb as in macros/mssm_xs.C
+void fill(const mssm_xs_tools::Point& point, double mA, std::vector<float>& grids)
+{
+  double xs[2][3];
+  xs[0][0] = 1000.*point[mssm_xs_tools::k_ggF_xsec_h];
+  xs[0][1] = 1000.*point[mssm_xs_tools::k_ggF_xsec_H];
+  xs[0][2] = 1000.*point[mssm_xs_tools::k_ggF_xsec_A];
+  xs[1][0] = mssm_xs_tools::Santander(point[mssm_xs_tools::k_mh], point[mssm_xs_tools::k_bbH4f_xsec_h], point[mssm_xs_tools::k_bbH_xsec_h]);
+  xs[1][1] = mssm_xs_tools::Santander(point[mssm_xs_tools::k_mH], point[mssm_xs_tools::k_bbH4f_xsec_H], point[mssm_xs_tools::k_bbH_xsec_H]);
+  xs[1][2] = mssm_xs_tools::Santander(mA, point[mssm_xs_tools::k_bbH4f_xsec_A], point[mssm_xs_tools::k_bbH_xsec_A]);
+  for(unsigned int iprod=0; iprod<2; ++iprod){
+    for(unsigned int idecay=0; idecay<3; ++idecay){
+      double sum = 0.;
+      for(unsigned int ihiggs=0; ihiggs<3; ++ihiggs){
+        double value = xs[iprod][ihiggs]*point[brs[idecay][ihiggs]]/1000.;
+        grids[iprod*9+idecay*3+ihiggs] = value; sum += value;
+      }
+      grids[18+iprod*3+idecay] = sum;
+    }
+  }
+  grids[24] = point[mssm_xs_tools::k_mh];
+  grids[25] = point[mssm_xs_tools::k_mH];
+}
+
+/// thread function: fill the rows first..last-1 of all grids
+void* worker(void* job)
+{
+  GridJob* buffer = (GridJob*)job;
+  const Binning& binning = *buffer->binning;
+  std::vector<float> grids(ngrids);
+  for(unsigned int ix=buffer->first; ix<buffer->last; ++ix){
+    double mA = binning.mA(ix);
+    for(unsigned int iy=0; iy<binning.n_tanb; ++iy){
+      fill(buffer->snapshot->point(mA, binning.tanb(iy)), mA, grids);
+      for(unsigned int igrid=0; igrid<ngrids; ++igrid){
+        (*buffer->values)[igrid][ix*binning.n_tanb+iy] = grids[igrid];
+      }
+    }
+  }
+  return 0;
+}
+
+/// write all grids to a ROOT file as TH2F (x: mA, y: tanb)
+bool writeHists(const char* output, const Binning& binning, const std::vector<std::vector<float> >& values)
+{
+  TFile* file = new TFile(output, "recreate");
+  if( file->IsZombie() ){
+    delete file;
+    return false;
+  }
+  for(unsigned int igrid=0; igrid<ngrids; ++igrid){
+    TH2F* hist = new TH2F(name(igrid).c_str(), name(igrid).c_str(), binning.n_mA, binning.min_mA, binning.max_mA, binning.n_tanb, binning.min_tanb, binning.max_tanb);
+    hist->SetXTitle("m_{A} [GeV]"); hist->SetYTitle("tan#beta");
+    for(unsigned int ix=0; ix<binning.n_mA; ++ix){
+      for(unsigned int iy=0; iy<binning.n_tanb; ++iy){
+        hist->SetBinContent(ix+1, iy+1, values[igrid][ix*binning.n_tanb+iy]);
+      }
+    }
+    hist->Write();
+  }
+  file->Close();
+  delete file;
+  return true;
+}
+
+/// write all grids to a flat file (see FlatGrid)
+bool writeFlat(const char* output, const Binning& binning, const std::vector<std::vector<float> >& values)
+{
+  std::vector<FlatGrid::Grid> grids(ngrids);
+  for(unsigned int igrid=0; igrid<ngrids; ++igrid){
+    FlatGrid::Grid& grid = grids[igrid];
+    grid.name = name(igrid);
+    grid.nx = binning.n_mA; grid.xmin = binning.min_mA; grid.xmax = binning.max_mA;
+    grid.ny = binning.n_tanb; grid.ymin = binning.min_tanb; grid.ymax = binning.max_tanb;
+    grid.values = values[igrid];
+  }
+  return FlatGrid::write(output, grids);
+}
+
+int main(int argc, char* argv[])
+{
+  // parse arguments
+  if( argc < 9 ){
+    std::cout << "Usage : " << argv[0] << " [input] [output] [n_mA min_mA max_mA n_tanb min_tanb max_tanb] [nthreads]\n"
+	      << " [input]    : input file of mssm_xs_tools (.root or .flat).\n"
+	      << " [output]   : output file; for the extension .flat the grids are written as a flat file (see\n"
+	      << "              FlatGrid), otherwise as TH2F (x: mA, y: tanb) to a ROOT file.\n"
+	      << " [n_mA ...] : binning of the grid; all values are evaluated at the bin centres.\n"
+	      << " [nthreads] : number of threads (default is 1).\n"
+	      << "For each production (gg, bb), Higgs boson (h, H, A) and decay (tautau, mumu, bb) the grid\n"
+	      << "[production][Higgs]_[decay] of xs x BR in pb is written, as given by macros/mssm_xs.C. The\n"
+	      << "grids [production]Phi_[decay] contain the sum over all Higgs bosons, the grids mh and mH\n"
+	      << "the masses of h and H.\n example: "
+	      << argv[0] << " data/out.mhmax-mu+200-7TeV-tanbHigh-nnlo.root mssm-xs-grid.root 96 50 1010 60 0 60 8" << std::endl;
+    return 0;
+  }
+  Binning binning;
+  binning.n_mA   = atoi(argv[3]); binning.min_mA   = atof(argv[4]); binning.max_mA   = atof(argv[5]);
+  binning.n_tanb = atoi(argv[6]); binning.min_tanb = atof(argv[7]); binning.max_tanb = atof(argv[8]);
+  unsigned int nthreads = argc>9 ? atoi(argv[9]) : 1;
+  if( binning.n_mA==0 || binning.n_tanb==0 || !(binning.min_mA<binning.max_mA) || !(binning.min_tanb<binning.max_tanb) ){
+    std::cout << "ERROR: invalid binning" << std::endl;
+    return 1;
+  }
+  if( nthreads<1 ){ nthreads=1; }
+  if( nthreads>binning.n_mA ){ nthreads=binning.n_mA; }
+  /*
+    Implementation
+  */
+  mssm_xs_tools xs;
+  if( !xs.SetInput(argv[1]) ){
+    return 1;
+  }
+  // all tables are read here, the threads only use the const snapshot
+  mssm_xs_tools::Snapshot snapshot(xs);
+  std::vector<std::vector<float> > values(ngrids, std::vector<float>(binning.n_mA*binning.n_tanb));
+  std::vector<GridJob> jobs(nthreads);
+  for(unsigned int ijob=0; ijob<jobs.size(); ++ijob){
+    jobs[ijob].snapshot = &snapshot; jobs[ijob].binning = &binning; jobs[ijob].values = &values;
+    jobs[ijob].first = binning.n_mA*ijob/nthreads; jobs[ijob].last = binning.n_mA*(ijob+1)/nthreads;
+  }
+  if( nthreads==1 ){
+    worker(&jobs[0]);
+  }
+  else{
+    TThread::Initialize();
+    std::vector<TThread*> threads;
+    for(unsigned int ijob=0; ijob<jobs.size(); ++ijob){
+      threads.push_back(new TThread(TString::Format("mssm-xs-grid%d", ijob), &worker, &jobs[ijob]));
+      threads.back()->Run();
+    }
+    for(std::vector<TThread*>::iterator thread=threads.begin(); thread!=threads.end(); ++thread){
+      (*thread)->Join(); delete *thread;
+    }
+  }
+  bool success = FlatGrid::flat(argv[2]) ? writeFlat(argv[2], binning, values) : writeHists(argv[2], binning, values);
+  if( !success ){
+    std::cout << "ERROR: could not write " << argv[2] << std::endl;
+    return 1;
+  }
+  std::cout << "grids  = " << ngrids << std::endl;
+  std::cout << "points = " << binning.n_mA*binning.n_tanb << std::endl;
+  return 0;
+}
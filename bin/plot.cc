@@ -1,8 +1,12 @@
+#include <map>
 #include <vector>
+#include <fstream>
 #include <sstream>
 #include <iostream>
 #include <iterator>
+#include <stdlib.h>
 
+#include "TSystem.h"
 #include "HiggsAnalysis/HiggsToTauTau/interface/PlotLimits.h"
 #include "FWCore/PythonParameterSet/interface/MakeParameterSets.h"
 
@@ -50,7 +54,8 @@ void addParameter(edm::ParameterSet& pset, const std::string& key, const std::st
   }
 }
 
-int main(int argc, char* argv[])
+// list of all supported limit types
+std::vector<std::string> limitTypes()
 {
   std::vector<std::string> types;
   // show full CLs cross section limits 
@@ -96,29 +101,56 @@ int main(int argc, char* argv[])
   types.push_back(std::string("--HIG-12-050"));
   // show limits as of HIG-13-004
   types.push_back(std::string("--HIG-13-004"));
+  return types;
+}
 
-  // parse arguments
-  if(argc<3){
-    std::cout << "Usage : " << argv[0] << " [limit-type] [layout.py] [target-dir] [option1=value1 [option2=value2] ...]" << std::endl;
-    return 0;
-  }
-  if( std::find(types.begin(), types.end(), std::string(argv[1])) == types.end()){
-    std::cout << " ERROR: The specified limit type (" << argv[1] << ")"
+// check whether a limit type is supported; print all supported limit types if not
+bool checkType(const std::string& type)
+{
+  std::vector<std::string> types = limitTypes();
+  if( std::find(types.begin(), types.end(), type) == types.end()){
+    std::cout << " ERROR: The specified limit type (" << type << ")"
 	      << " is not supported. Available limit types are:" << std::endl;
-    for( std::vector<std::string>::const_iterator type = types.begin(); type!=types.end(); ++type ){
-      std::cout << "  " << *type << std::endl;
+    for( std::vector<std::string>::const_iterator t = types.begin(); t!=types.end(); ++t ){
+      std::cout << "  " << *t << std::endl;
     }
-    exit(0);
+    return false;
   }
-  if(!edm::readPSetsFrom(argv[2])->existsAs<edm::ParameterSet>("layout")){
-    std::cout << " ERROR: ParameterSet 'layout' is missing in your configuration file" << std::endl; exit(0);
+  return true;
+}
+
+// return the ParameterSet 'layout' of a layout file; each layout file is only parsed once
+const edm::ParameterSet& readLayout(const std::string& filename)
+{
+  static std::map<std::string, edm::ParameterSet> layouts;
+  std::map<std::string, edm::ParameterSet>::const_iterator layout = layouts.find(filename);
+  if(layout==layouts.end()){
+    boost::shared_ptr<edm::ParameterSet> cfg = edm::readPSetsFrom(filename);
+    if(!cfg->existsAs<edm::ParameterSet>("layout")){
+      std::cout << " ERROR: ParameterSet 'layout' is missing in your configuration file" << std::endl; exit(0);
+    }
+    layout = layouts.insert(std::make_pair(filename, cfg->getParameterSet("layout"))).first;
   }
-  edm::ParameterSet layout =  edm::readPSetsFrom(argv[2])->getParameterSet("layout");
+  return layout->second;
+}
 
-  // define number of required parameters
-  int REQUIRED = (std::string(argv[1]).find("HIG")==std::string::npos) ? 4 : 3;
-  // get intput directory up to one before mass points
-  const char* directory((std::string(argv[1]).find("HIG")==std::string::npos) ? argv[3] : argv[1]);
+// update layout with an overridden option in key=value format
+void overrideParameter(edm::ParameterSet& layout, const std::string& argument)
+{
+  size_t equals_pos = argument.find("=");
+  if(equals_pos == std::string::npos){
+    std::cerr << "I don't understand the layout override: " << argument <<
+      " The format should be key=value" << std::endl;
+    exit(1);
+  }
+  std::string key = argument.substr(0, equals_pos);
+  std::string value = argument.substr(equals_pos+1, argument.length() - equals_pos+1);
+  addParameter(layout, key, value);
+}
+
+// derive the output name from the input directory
+std::string output(const char* directory)
+{
   std::string directory_string(directory);
   // chop off the prepended directories if needed for out
   if(directory_string.rfind("/")+1 == directory_string.length()){
@@ -127,31 +159,21 @@ int main(int argc, char* argv[])
   else{
     directory_string = directory_string.substr(2, std::string::npos);
   }
-  std::string out(directory_string.substr(directory_string.rfind("/")+1));
+  return directory_string.substr(directory_string.rfind("/")+1);
+}
 
-  // update layout with overridden options
-  if(argc>REQUIRED){
-    for(int i=REQUIRED; i<argc; ++i){
-      std::string argument(argv[i]);
-      size_t equals_pos = argument.find("=");
-      if(equals_pos == std::string::npos){
-        std::cerr << "I don't understand the layout override: " << argument <<
-          " The format should be key=value" << std::endl;
-        exit(1);
-      }
-      std::string key = argument.substr(0, equals_pos);
-      std::string value = argument.substr(equals_pos+1, argument.length() - equals_pos+1);
-      addParameter(layout, key, value);
-    }
-  }
+// make a single plot of limit type type from directory. If cache is given the combine output files
+// are buffered there, such that they are only read once for all plots of a session
+void makePlot(const std::string& type, const edm::ParameterSet& layout, const char* directory, LimitCache* cache=0)
+{
   bool mssm = layout.existsAs<bool>("mssm") ? layout.getParameter<bool>("mssm") : false;
   bool expectedOnly = layout.existsAs<bool>("expectedOnly") ? layout.getParameter<bool>("expectedOnly") : false;
-  
+
   /*
     Implementations
   */
-  PlotLimits plot(out.c_str(), layout);
-  if(std::string(argv[1]) == std::string("--CLs")){
+  PlotLimits plot(output(directory).c_str(), layout, cache);
+  if(type == std::string("--CLs")){
     // observed limit
     TGraph* observed  = 0;
     if(!expectedOnly){
@@ -173,7 +195,7 @@ int main(int argc, char* argv[])
     plot.plotLimit(*canv, inner, outer, expected, observed);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--tanb") ){
+  if( type == std::string("--tanb") ){
     // observed limit
     TGraph* observed  = 0;
     if(!expectedOnly){
@@ -195,7 +217,7 @@ int main(int argc, char* argv[])
     plot.plotTanb(*canv, inner, outer, expected, observed, directory);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--bayesian") ){
+  if( type == std::string("--bayesian") ){
     // observed limit
     TGraph* observed  = 0;
     if(!expectedOnly){
@@ -218,7 +240,7 @@ int main(int argc, char* argv[])
     plot.plotLimit(*canv, inner, outer, expected, observed);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--injected") ){
+  if( type == std::string("--injected") ){
     // observed limit
     TGraph* observed  = 0;
     if(!expectedOnly){
@@ -240,7 +262,7 @@ int main(int argc, char* argv[])
     plot.plotLimit(*canv, inner, outer, expected, observed);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--injected-sig") ){
+  if( type == std::string("--injected-sig") ){
     // observed limit
     TGraph* observed  = 0;
     if(!expectedOnly){
@@ -262,7 +284,7 @@ int main(int argc, char* argv[])
     plot.plotSignificance(*canv, inner, outer, expected, observed);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--injected-pval") ){
+  if( type == std::string("--injected-pval") ){
     // observed limit
     TGraph* observed  = 0;
     if(!expectedOnly){
@@ -284,7 +306,7 @@ int main(int argc, char* argv[])
     plot.plotPValue(*canv, inner, outer, expected, observed);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--asymptotic") ){
+  if( type == std::string("--asymptotic") ){
     // observed limit
     TGraph* observed  = 0;
     if(!expectedOnly){
@@ -306,7 +328,7 @@ int main(int argc, char* argv[])
     plot.plotLimit(*canv, inner, outer, expected, observed);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--significance") ){
+  if( type == std::string("--significance") ){
     // observed limit
     TGraph* observed  = 0;
     if(!expectedOnly){
@@ -327,7 +349,7 @@ int main(int argc, char* argv[])
     plot.plotSignificance(*canv, inner, outer, expected, observed);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--significance-frequentist") ){
+  if( type == std::string("--significance-frequentist") ){
     // observed significance
     TGraph* observed  = new TGraph();
     plot.fillCentral(directory, observed, "higgsCombineSIG-obs.ProfileLikelihood.mH$MASS");
@@ -340,7 +362,7 @@ int main(int argc, char* argv[])
     plot.plotSignificance(*canv, 0, 0, expected, observed);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--pvalue-frequentist") ){
+  if( type == std::string("--pvalue-frequentist") ){
     // observed p-value
     TGraph* observed  = new TGraph();
     plot.fillCentral(directory, observed, "higgsCombinePVAL-obs.ProfileLikelihood.mH$MASS");
@@ -353,7 +375,7 @@ int main(int argc, char* argv[])
     plot.plotPValue(*canv, 0, 0, expected, observed);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--max-likelihood") ){
+  if( type == std::string("--max-likelihood") ){
     // central value
     TGraph* central  = new TGraph();
     plot.fillCentral(directory, central, "higgsCombineTest.MaxLikelihoodFit.mH$MASS");
@@ -366,7 +388,7 @@ int main(int argc, char* argv[])
     plot.plotLimit(*canv, inner, 0, central, 0);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--likelihood-scan") ){
+  if( type == std::string("--likelihood-scan") ){
     // best fit
     //TGraph* central  = new TGraph(); //not needed for plot1DScan
     // +/- 1 sigma to bestfit
@@ -377,7 +399,7 @@ int main(int argc, char* argv[])
     //plot.plotSignalStrength(*canv, innerBand, central, directory);
     plot.plot1DScan(*canv, directory);
   }
-  if( std::string(argv[1]) == std::string("--likelihood-scan-mass") ){
+  if( type == std::string("--likelihood-scan-mass") ){
     // Likelihood
     TGraph* observed  = new TGraph(); //not needed for plot1DScan
     plot.fillCentral(directory, observed, "NLL");
@@ -386,7 +408,7 @@ int main(int argc, char* argv[])
     TCanvas* canv = new TCanvas("canv", "Limits", 600, 600);
     plot.plotMassScan(*canv, observed);
   }
-  if( std::string(argv[1]) == std::string("--mass-estimate") ){
+  if( type == std::string("--mass-estimate") ){
     // Likelihood
     TGraph* observed  = new TGraph(); //not needed for plot1DScan
     plot.fillCentral(directory, observed, "NLL");
@@ -404,14 +426,14 @@ int main(int argc, char* argv[])
     plot.plotMassEstimate(*canv, inner, outer, expected, observed);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--multidim-fit") ){
+  if( type == std::string("--multidim-fit") ){
     // make the plot
     SetStyle();
     TCanvas* canv = new TCanvas("canv", "Limits", 600, 600);
     plot.plot2DScan(*canv, directory);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--HIG-11-020") ){
+  if( type == std::string("--HIG-11-020") ){
     // observed limit
     TGraph* observed  = 0;
     if(!expectedOnly){
@@ -436,7 +458,7 @@ int main(int argc, char* argv[])
     plot.plotTanb(*canv, inner, outer, expected, observed);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--HIG-11-029") ){
+  if( type == std::string("--HIG-11-029") ){
     // observed limit
     TGraph* observed  = 0;
     if(!expectedOnly){
@@ -463,7 +485,7 @@ int main(int argc, char* argv[])
     }
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--HIG-12-018") ){
+  if( type == std::string("--HIG-12-018") ){
     // observed limit
     TGraph* observed  = 0;
     if(!expectedOnly){
@@ -485,7 +507,7 @@ int main(int argc, char* argv[])
     plot.plotLimit(*canv, inner, outer, expected, observed);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--HIG-12-032") ){
+  if( type == std::string("--HIG-12-032") ){
     // observed limit
     TGraph* observed  = 0;
     if(!expectedOnly){
@@ -507,7 +529,7 @@ int main(int argc, char* argv[])
     plot.plotLimit(*canv, inner, outer, expected, observed);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--HIG-12-043") ){
+  if( type == std::string("--HIG-12-043") ){
     // observed limit
     TGraph* observed  = 0;
     if(!expectedOnly){
@@ -529,7 +551,7 @@ int main(int argc, char* argv[])
     plot.plotLimit(*canv, inner, outer, expected, observed);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--HIG-12-050") ){
+  if( type == std::string("--HIG-12-050") ){
     // observed limit
     TGraph* observed  = 0;
     if(!expectedOnly){
@@ -551,7 +573,7 @@ int main(int argc, char* argv[])
     plot.plotTanb(*canv, inner, outer, expected, observed);
   }
   // -----------------------------------------------------------------------------------------------------------------------
-  if( std::string(argv[1]) == std::string("--HIG-13-004") ){
+  if( type == std::string("--HIG-13-004") ){
     // observed limit
     TGraph* observed  = 0;
     if(!expectedOnly){
@@ -572,5 +594,133 @@ int main(int argc, char* argv[])
     TCanvas* canv = new TCanvas("canv", "Limits", 600, 600);
     plot.plotLimit(*canv, inner, outer, expected, observed);
   }
+}
+
+// run all jobs of a session file. Each line of the file corresponds to one job and has the same
+// format as the arguments of a single call: [limit-type] [layout.py] [target-dir] [option1=value1 ...].
+// Empty lines and lines starting with '#' are ignored. Each layout file is parsed only once and all
+// jobs share the same buffer of combine output files.
+int session(const char* filename)
+{
+  std::ifstream jobs(filename);
+  if(!jobs){
+    std::cout << " ERROR: could not open session file: " << filename << std::endl; exit(0);
+  }
+  LimitCache cache;
+  std::string line;
+  unsigned int njobs=0;
+  while(std::getline(jobs, line)){
+    std::stringstream stream(line);
+    std::vector<std::string> args((std::istream_iterator<std::string>(stream)), std::istream_iterator<std::string>());
+    if(args.empty() || args[0][0]=='#'){
+      continue;
+    }
+    if(args.size()<2 || !checkType(args[0])){
+      std::cout << " ERROR: skipping malformed job: " << line << std::endl;
+      continue;
+    }
+    // define number of required parameters
+    unsigned int REQUIRED = (args[0].find("HIG")==std::string::npos) ? 3 : 2;
+    if(args.size()<REQUIRED){
+      std::cout << " ERROR: skipping malformed job: " << line << std::endl;
+      continue;
+    }
+    edm::ParameterSet layout = readLayout(args[1]);
+    for(unsigned int i=REQUIRED; i<args.size(); ++i){
+      overrideParameter(layout, args[i]);
+    }
+    std::cout << "INFO: running job " << ++njobs << ": " << line << std::endl;
+    makePlot(args[0], layout, (args[0].find("HIG")==std::string::npos) ? args[2].c_str() : args[0].c_str(), &cache);
+  }
+  OutputWriter::instance().flush();
+  Profile::instance().finish();
+  std::cout << "INFO: " << njobs << " jobs done, " << cache.opened() << " files opened" << std::endl;
+  return 0;
+}
+
+// make a plot incrementally. The content of all files that are read for the plot is kept in a
+// manifest file in the target directory (plot.manifest). Only files that changed since the manifest
+// was written are read again and the plot is only remade if any file changed or if the manifest was
+// written for a different job. For interval>0 the files are checked for changes every interval seconds
+// until the process is stopped.
+int watch(const std::string& type, const edm::ParameterSet& layout, const char* directory, const std::string& job, unsigned int interval)
+{
+  LimitCache cache(layout.existsAs<unsigned int>("verbosity") ? layout.getParameter<unsigned int>("verbosity") : 0);
+  std::string manifest = std::string(directory)+"/plot.manifest";
+  std::string tag;
+  int changed = cache.restore(manifest.c_str(), &tag);
+  if(changed==0 && tag==job){
+    std::cout << "INFO: no changes since last plot" << std::endl;
+  }
+  else{
+    makePlot(type, layout, directory, &cache);
+    OutputWriter::instance().flush();
+    Profile::instance().finish();
+    cache.save(manifest.c_str(), job);
+    std::cout << "INFO: " << cache.opened() << " files opened" << std::endl;
+  }
+  while(interval>0){
+    gSystem->Sleep(1000*interval);
+    unsigned int nfiles = cache.update();
+    if(nfiles>0){
+      std::cout << "INFO: " << nfiles << " files changed, remaking plot" << std::endl;
+      makePlot(type, layout, directory, &cache);
+      OutputWriter::instance().flush();
+      Profile::instance().finish();
+      cache.save(manifest.c_str(), job);
+    }
+  }
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  // parse arguments
+  if(argc<3){
+    std::cout << "Usage : " << argv[0] << " [limit-type] [layout.py] [target-dir] [option1=value1 [option2=value2] ...]" << std::endl
+	      << "        " << argv[0] << " --session [jobs.txt]  (one job per line in the format given above)" << std::endl
+	      << "        " << argv[0] << " --watch [interval] [limit-type] [layout.py] [target-dir] [option1=value1 ...]  (interval in seconds, 0: single incremental pass; not for HIG-* types)" << std::endl;
+    return 0;
+  }
+  if(std::string(argv[1]) == std::string("--session")){
+    return session(argv[2]);
+  }
+  // incremental mode: strip off option and interval from the arguments
+  int interval = -1;
+  if(std::string(argv[1]) == std::string("--watch")){
+    if(argc<5){
+      std::cout << "Usage : " << argv[0] << " --watch [interval] [limit-type] [layout.py] [target-dir] [option1=value1 ...]" << std::endl;
+      return 0;
+    }
+    interval = atoi(argv[2]); argc-=2; argv+=2;
+  }
+  if(!checkType(argv[1])){
+    exit(0);
+  }
+  edm::ParameterSet layout = readLayout(argv[2]);
+
+  // define number of required parameters
+  int REQUIRED = (std::string(argv[1]).find("HIG")==std::string::npos) ? 4 : 3;
+  // get intput directory up to one before mass points
+  const char* directory((std::string(argv[1]).find("HIG")==std::string::npos) ? argv[3] : argv[1]);
+
+  // update layout with overridden options
+  std::string job = std::string(argv[1])+" "+argv[2];
+  if(argc>REQUIRED){
+    for(int i=REQUIRED; i<argc; ++i){
+      overrideParameter(layout, argv[i]);
+      job += std::string(" ")+argv[i];
+    }
+  }
+  if(interval>=0){
+    if(std::string(argv[1]).find("HIG")!=std::string::npos){
+      std::cout << "ERROR: --watch is not supported for limit type " << argv[1] << std::endl;
+      return 1;
+    }
+    return watch(argv[1], layout, directory, job, interval);
+  }
+  makePlot(argv[1], layout, directory);
+  OutputWriter::instance().flush();
+  Profile::instance().finish();
   return 0;
 }
@@ -1,9 +1,9 @@
 #ifndef CrossSection_h
 #define CrossSection_h
 
-#include <map>
 #include <string>
-#include <utility>
+#include <vector>
+#include <cstdlib>
 #include <iostream>
 
 /**
@@ -20,11 +20,27 @@
 
    The range from Higgs masses between 90 GeV and 1000 GeV for ggH and qqH and from 90 GeV 
    to 300 GeV for WH, ZH, ttH. For those mass points, which are not tabluated on the TWikis, 
-   linear interpolation is applied. 
+   linear interpolation is applied. All values are kept in static tables sorted by mass, that
+   are searched by bisection.
+
+   Processes can be given by name or by their enum value. The name can be resolved once with the
+   function process, such that repeated evaluations (e.g. for a whole list of masses with the
+   vectorial version of evaluate) do not involve any string comparisons.
 */
 
 class CrossSection {
 
+ public:
+  /// known processes; signal processes and BR come first, followed by the background processes
+  enum Process { kggH, kqqH, kWH, kZH, kttH, kBR, kttbar, kW, kZ, kWtop, ktopt, ktops, kWW, kWZ, kZZ, kQCD, kVV, kUnknown };
+  /// tabulated values of a single process as a function of the Higgs boson mass
+  struct Table {
+    /// pairs of mass and value, sorted by mass
+    const float (*points)[2];
+    /// number of points
+    unsigned int size;
+  };
+
  public:
   /// default constructor
   CrossSection(float ecms) : ecms_(ecms){};
@@ -33,1231 +49,1243 @@ class CrossSection {
 
   /// get cross section; values which are not mapped are interpolated
   /// valules which are out of range return 0
-  float evaluate(const char* process, float mass);
+  float evaluate(const char* proc, float mass);
+  /// get cross section for a process given by its enum value
+  float evaluate(Process process, float mass);
+  /// get cross sections for a list of masses; results are written to values
+  void evaluate(Process process, const std::vector<float>& masses, std::vector<float>& values);
+  /// resolve the process name; unknown processes return kUnknown
+  static Process process(const char* name);
 
  private:
-  /// load ggH cross sections
-  void ggH();
-  /// load qqH cross sections
-  void qqH();
-  /// load WH cross sections
-  void WH();
-  /// load ZH cross sections
-  void ZH();
-  /// load ttH cross sections
-  void ttH();
-  /// load BR
-  void BR();
-  /// approximate scale factors for 7 TeV to 8 Tev
-  void seven2xxxTeV();
-  /// get actual value from map
-  float linear(float mass, std::map<float, float>& map);
+  /// ggH cross sections
+  static const Table& ggH();
+  /// qqH cross sections
+  static const Table& qqH();
+  /// WH cross sections
+  static const Table& WH();
+  /// ZH cross sections
+  static const Table& ZH();
+  /// ttH cross sections
+  static const Table& ttH();
+  /// BR
+  static const Table& BR();
+  /// table of a signal process or BR
+  static const Table& table(Process process);
+  /// approximate scale factors for signal from 7 TeV to ecms
+  static const Table& seven2xxxTeV(float ecms);
+  /// approximate scale factors for background processes from 7 TeV to ecms; background processes
+  /// for which no scale factor is known return 0
+  static float seven2xxxTeV(float ecms, Process process);
+  /// get actual value from table; the mass is looked up by binary search
+  static float linear(float mass, const Table& table);
+  /// check that process is known; exits otherwise
+  static void check(Process process);
   /// this is the SM background sample for which only the scale to 
   /// different ecms will be provided
-  bool background(std::string proc){
-    return (proc == std::string("ttbar")||
-	    proc == std::string("top-t")||
-	    proc == std::string("top-s")||
-	    proc == std::string("W-top")||
-	    proc == std::string("W"    )||
-	    proc == std::string("Z"    )||
-	    proc == std::string("QCD"  )||
-	    proc == std::string("WW"   )||
-	    proc == std::string("WZ"   )||
-	    proc == std::string("ZZ"   )||
-	    proc == std::string("VV"   ));
-  }
+  static bool background(Process process){ return kttbar<=process && process<kUnknown; }
 
  private:
   /// center of mass energy for the evaluation of the cross sections
   float ecms_;
-  /// cross section map for desired process
-  std::map<float, float> xsec_;
-  /// for the time being these are the scale factors to go from 7 TeV to 8 TeV
-  std::map<float, float> scale_;
-  /// these are the scale factors for background processes
-  std::map<std::string, float> scaleBG_;
 };
 
-inline void
-CrossSection::seven2xxxTeV()
+inline const CrossSection::Table&
+CrossSection::seven2xxxTeV(float ecms)
 {
-  bool scaled=false;
-  if(ecms_ == 8){
-    scaled=true;
-    /// provide BG scales		     
-    scaleBG_[std::string("ttbar")] = 1.42982; 
-    scaleBG_[std::string("W"    )] = 1.15786; 
-    scaleBG_[std::string("Z"    )] = 1.14951;
-    scaleBG_[std::string("W-top")] = 1.42024;
-    scaleBG_[std::string("top-t")] = 1.32469;
-    scaleBG_[std::string("top-s")] = 1.22067;
-    scaleBG_[std::string("WW"   )] = 1.21510; 
-    scaleBG_[std::string("WZ"   )] = 1.23344;
-    scaleBG_[std::string("ZZ"   )] = 1.21944;
-    /// provide ggH signal scales
-    scale_[  90] = 1.27394;
-    scale_[ 120] = 1.27742;
-    scale_[ 125] = 1.28090;
-    scale_[ 130] = 1.28437;
-    scale_[ 135] = 1.28775;
-    scale_[ 140] = 1.29112;
-    scale_[ 145] = 1.29439;
-    scale_[ 150] = 1.29766;
-    scale_[ 160] = 1.30403;
-    scale_[ 170] = 1.31031;
-    scale_[ 180] = 1.31641;
-    scale_[ 190] = 1.32237;
-    scale_[ 200] = 1.32822;
-    scale_[ 250] = 1.35530;
-    scale_[ 300] = 1.38238;
-    scale_[ 350] = 1.40661;
-    scale_[ 400] = 1.43085;
-    scale_[ 450] = 1.45471;
-    scale_[ 500] = 1.47857;
-    scale_[ 550] = 1.50211;
-    scale_[ 600] = 1.52566;
-    scale_[1000] = 1.52566;
+  /// provide ggH signal scales
+  static const float points8TeV[][2] = {
+    {  90, 1.27394 },
+    { 120, 1.27742 },
+    { 125, 1.28090 },
+    { 130, 1.28437 },
+    { 135, 1.28775 },
+    { 140, 1.29112 },
+    { 145, 1.29439 },
+    { 150, 1.29766 },
+    { 160, 1.30403 },
+    { 170, 1.31031 },
+    { 180, 1.31641 },
+    { 190, 1.32237 },
+    { 200, 1.32822 },
+    { 250, 1.35530 },
+    { 300, 1.38238 },
+    { 350, 1.40661 },
+    { 400, 1.43085 },
+    { 450, 1.45471 },
+    { 500, 1.47857 },
+    { 550, 1.50211 },
+    { 600, 1.52566 },
+    {1000, 1.52566 }
+  };
+  static const float points14TeV[][2] = {
+    {  90, 3.27581 },
+    { 115, 3.27581 },
+    { 120, 3.31737 },
+    { 125, 3.35893 },
+    { 130, 3.40049 },
+    { 135, 3.44132 },
+    { 140, 3.48215 },
+    { 145, 3.52248 },
+    { 150, 3.56281 },
+    { 160, 3.64248 },
+    { 170, 3.72139 },
+    { 180, 3.79989 },
+    { 190, 3.87800 },
+    { 200, 3.95563 },
+    { 250, 4.33932 },
+    { 300, 4.72300 },
+    { 350, 5.10642 },
+    { 400, 5.48983 },
+    { 450, 5.91051 },
+    { 500, 6.33118 },
+    { 550, 6.78806 },
+    { 600, 7.24494 },
+    {1000, 7.24494 }
+  };
+  static const Table table8TeV  = { points8TeV , sizeof(points8TeV )/sizeof(points8TeV [0]) };
+  static const Table table14TeV = { points14TeV, sizeof(points14TeV)/sizeof(points14TeV[0]) };
+  if(ecms == 8){
+    return table8TeV;
   }
-  if(ecms_ == 14){
-    scaled=true;
-    /// provide BG scales		     
-    scaleBG_[std::string("ttbar")] = 5.59001; 
-    scaleBG_[std::string("W"    )] = 2.09545; 
-    scaleBG_[std::string("Z"    )] = 2.02904;
-    scaleBG_[std::string("W-top")] = 5.32411;
-    scaleBG_[std::string("top-t")] = 3.88168;
-    scaleBG_[std::string("top-s")] = 2.65179;
-    scaleBG_[std::string("WW"   )] = 2.62549; 
-    scaleBG_[std::string("WZ"   )] = 2.79381;
-    scaleBG_[std::string("ZZ"   )] = 2.64949;
-    /// provide ggH signal scales
-    scale_[  90] = 3.27581;
-    scale_[ 115] = 3.27581;
-    scale_[ 120] = 3.31737;
-    scale_[ 125] = 3.35893;
-    scale_[ 130] = 3.40049;
-    scale_[ 135] = 3.44132;
-    scale_[ 140] = 3.48215;
-    scale_[ 145] = 3.52248;
-    scale_[ 150] = 3.56281;
-    scale_[ 160] = 3.64248;
-    scale_[ 170] = 3.72139;
-    scale_[ 180] = 3.79989;
-    scale_[ 190] = 3.87800;
-    scale_[ 200] = 3.95563;
-    scale_[ 250] = 4.33932;
-    scale_[ 300] = 4.72300;
-    scale_[ 350] = 5.10642;
-    scale_[ 400] = 5.48983;
-    scale_[ 450] = 5.91051;
-    scale_[ 500] = 6.33118;
-    scale_[ 550] = 6.78806;
-    scale_[ 600] = 7.24494;
-    scale_[1000] = 7.24494;
-  }
-  if(!scaled){
-    std::cerr 
-      << "Warning: the ecms that you chose is not implemented: " << ecms_ << std::endl
-      << "Available values of ecms are: 8(TeV), 14(TeV)" << std::endl;
-    exit(0);
+  if(ecms == 14){
+    return table14TeV;
   }
+  std::cerr 
+    << "Warning: the ecms that you chose is not implemented: " << ecms << std::endl
+    << "Available values of ecms are: 8(TeV), 14(TeV)" << std::endl;
+  exit(0);
+}
+
+inline float
+CrossSection::seven2xxxTeV(float ecms, Process process)
+{
+  /// provide BG scales in the order of the enum, starting from kttbar (QCD and VV are not scaled)
+  static const float scales8TeV [] = { 1.42982, 1.15786, 1.14951, 1.42024, 1.32469, 1.22067, 1.21510, 1.23344, 1.21944, 0., 0. };
+  static const float scales14TeV[] = { 5.59001, 2.09545, 2.02904, 5.32411, 3.88168, 2.65179, 2.62549, 2.79381, 2.64949, 0., 0. };
+  // check for a valid ecms
+  seven2xxxTeV(ecms);
+  return ecms == 8 ? scales8TeV[process-kttbar] : scales14TeV[process-kttbar];
 }
 
-inline void
+inline const CrossSection::Table&
 CrossSection::ggH()
 {
-  xsec_[  90.0] = 29.47; 	
-  xsec_[  95.0] = 26.58; 	
-  xsec_[ 100.0] = 24.02; 	
-  xsec_[ 105.0] = 21.78; 	
-  xsec_[ 110.0] = 19.84; 	
-  xsec_[ 110.5] = 19.65; 	
-  xsec_[ 111.0] = 19.48; 	
-  xsec_[ 111.5] = 19.30; 	
-  xsec_[ 112.0] = 19.13; 	
-  xsec_[ 112.5] = 18.95; 	
-  xsec_[ 113.0] = 18.79; 	
-  xsec_[ 113.5] = 18.62; 	
-  xsec_[ 114.0] = 18.45; 	
-  xsec_[ 114.5] = 18.29; 	
-  xsec_[ 115.0] = 18.13; 	
-  xsec_[ 115.5] = 17.97; 	
-  xsec_[ 116.0] = 17.82; 	
-  xsec_[ 116.5] = 17.66; 	
-  xsec_[ 117.0] = 17.51; 	
-  xsec_[ 117.5] = 17.36; 	
-  xsec_[ 118.0] = 17.21; 	
-  xsec_[ 118.5] = 17.06; 	
-  xsec_[ 119.0] = 16.92; 	
-  xsec_[ 119.5] = 16.78; 	
-  xsec_[ 120.0] = 16.63; 	
-  xsec_[ 120.5] = 16.49; 	
-  xsec_[ 121.0] = 16.36; 	
-  xsec_[ 121.5] = 16.22; 	
-  xsec_[ 122.0] = 16.08; 	
-  xsec_[ 122.5] = 15.94; 	
-  xsec_[ 123.0] = 15.82; 	
-  xsec_[ 123.5] = 15.69; 	
-  xsec_[ 124.0] = 15.56; 	
-  xsec_[ 124.5] = 15.43; 	
-  xsec_[ 125.0] = 15.31; 	
-  xsec_[ 125.5] = 15.18; 	
-  xsec_[ 126.0] = 15.06; 	
-  xsec_[ 126.5] = 14.94; 	
-  xsec_[ 127.0] = 14.82; 	
-  xsec_[ 127.5] = 14.70; 	
-  xsec_[ 128.0] = 14.58; 	
-  xsec_[ 128.5] = 14.46; 	
-  xsec_[ 129.0] = 14.35; 	
-  xsec_[ 129.5] = 14.23; 	
-  xsec_[ 130.0] = 14.12; 	
-  xsec_[ 130.5] = 14.01; 	
-  xsec_[ 131.0] = 13.90; 	
-  xsec_[ 131.5] = 13.80; 	
-  xsec_[ 132.0] = 13.69; 	
-  xsec_[ 132.5] = 13.58; 	
-  xsec_[ 133.0] = 13.48; 	
-  xsec_[ 133.5] = 13.37; 	
-  xsec_[ 134.0] = 13.28; 	
-  xsec_[ 134.5] = 13.18; 	
-  xsec_[ 135.0] = 13.08; 	
-  xsec_[ 135.5] = 12.98; 	
-  xsec_[ 136.0] = 12.88; 	
-  xsec_[ 136.5] = 12.78; 	
-  xsec_[ 137.0] = 12.68; 	
-  xsec_[ 137.5] = 12.60; 	
-  xsec_[ 138.0] = 12.50; 	
-  xsec_[ 138.5] = 12.40; 	
-  xsec_[ 139.0] = 12.31; 	
-  xsec_[ 139.5] = 12.22; 	
-  xsec_[ 140.0] = 12.13; 	
-  xsec_[ 141.0] = 11.95; 	
-  xsec_[ 142.0] = 11.78; 	
-  xsec_[ 143.0] = 11.60; 	
-  xsec_[ 144.0] = 11.44; 	
-  xsec_[ 145.0] = 11.27; 	
-  xsec_[ 146.0] = 11.12; 	
-  xsec_[ 147.0] = 10.96; 	
-  xsec_[ 148.0] = 10.80; 	
-  xsec_[ 149.0] = 10.65; 	
-  xsec_[ 150.0] = 10.50; 	
-  xsec_[ 151.0] = 10.36; 	
-  xsec_[ 152.0] = 10.21; 	
-  xsec_[ 153.0] = 10.07; 	
-  xsec_[ 154.0] = 9.934; 	
-  xsec_[ 155.0] = 9.795; 	
-  xsec_[ 156.0] = 9.655; 	
-  xsec_[ 157.0] = 9.514; 	
-  xsec_[ 158.0] = 9.367; 	
-  xsec_[ 159.0] = 9.225; 	
-  xsec_[ 160.0] = 9.080; 	
-  xsec_[ 162.0] = 8.770; 	
-  xsec_[ 164.0] = 8.465; 	
-  xsec_[ 166.0] = 8.190; 	
-  xsec_[ 168.0] = 7.952; 	
-  xsec_[ 170.0] = 7.729; 	
-  xsec_[ 172.0] = 7.515; 	
-  xsec_[ 174.0] = 7.310; 	
-  xsec_[ 176.0] = 7.112; 	
-  xsec_[ 178.0] = 6.923; 	
-  xsec_[ 180.0] = 6.739; 	
-  xsec_[ 182.0] = 6.553; 	
-  xsec_[ 184.0] = 6.379; 	
-  xsec_[ 186.0] = 6.212; 	
-  xsec_[ 188.0] = 6.050; 	
-  xsec_[ 190.0] = 5.896; 	
-  xsec_[ 192.0] = 5.751; 	
-  xsec_[ 194.0] = 5.616; 	
-  xsec_[ 196.0] = 5.487; 	
-  xsec_[ 198.0] = 5.364; 	
-  xsec_[ 200.0] = 5.249; 	
-  xsec_[ 202.0] = 5.136; 	
-  xsec_[ 204.0] = 5.027; 	
-  xsec_[ 206.0] = 4.924; 	
-  xsec_[ 208.0] = 4.822; 	
-  xsec_[ 210.0] = 4.723; 	
-  xsec_[ 212.0] = 4.630; 	
-  xsec_[ 214.0] = 4.539; 	
-  xsec_[ 216.0] = 4.454; 	
-  xsec_[ 218.0] = 4.369; 	
-  xsec_[ 220.0] = 4.288; 	
-  xsec_[ 222.0] = 4.207; 	
-  xsec_[ 224.0] = 4.128; 	
-  xsec_[ 226.0] = 4.053; 	
-  xsec_[ 228.0] = 3.980; 	
-  xsec_[ 230.0] = 3.908; 	
-  xsec_[ 232.0] = 3.839; 	
-  xsec_[ 234.0] = 3.771; 	
-  xsec_[ 236.0] = 3.707; 	
-  xsec_[ 238.0] = 3.643; 	
-  xsec_[ 240.0] = 3.581; 	
-  xsec_[ 242.0] = 3.523; 	
-  xsec_[ 244.0] = 3.468; 	
-  xsec_[ 246.0] = 3.414; 	
-  xsec_[ 248.0] = 3.362; 	
-  xsec_[ 250.0] = 3.312; 	
-  xsec_[ 252.0] = 3.261; 	
-  xsec_[ 254.0] = 3.212; 	
-  xsec_[ 256.0] = 3.164; 	
-  xsec_[ 258.0] = 3.118; 	
-  xsec_[ 260.0] = 3.072; 	
-  xsec_[ 262.0] = 3.028; 	
-  xsec_[ 264.0] = 2.984; 	
-  xsec_[ 266.0] = 2.944; 	
-  xsec_[ 268.0] = 2.903; 	
-  xsec_[ 270.0] = 2.864; 	
-  xsec_[ 272.0] = 2.828; 	
-  xsec_[ 274.0] = 2.793; 	
-  xsec_[ 276.0] = 2.760; 	
-  xsec_[ 278.0] = 2.728; 	
-  xsec_[ 280.0] = 2.696; 	
-  xsec_[ 282.0] = 2.664; 	
-  xsec_[ 284.0] = 2.633; 	
-  xsec_[ 286.0] = 2.603; 	
-  xsec_[ 288.0] = 2.574; 	
-  xsec_[ 290.0] = 2.546; 	
-  xsec_[ 295.0] = 2.480; 	
-  xsec_[ 300.0] = 2.422; 	
-  xsec_[ 305.0] = 2.369; 	
-  xsec_[ 310.0] = 2.322; 	
-  xsec_[ 315.0] = 2.281; 	
-  xsec_[ 320.0] = 2.247; 	
-  xsec_[ 325.0] = 2.221; 	
-  xsec_[ 330.0] = 2.204; 	
-  xsec_[ 335.0] = 2.195; 	
-  xsec_[ 340.0] = 2.198; 	
-  xsec_[ 345.0] = 2.225; 	
-  xsec_[ 350.0] = 2.306; 	
-  xsec_[ 360.0] = 2.361; 	
-  xsec_[ 370.0] = 2.341; 	
-  xsec_[ 380.0] = 2.266; 	
-  xsec_[ 390.0] = 2.158; 	
-  xsec_[ 400.0] = 2.032; 	
-  xsec_[ 420.0] = 1.756; 	
-  xsec_[ 440.0] = 1.482; 	
-  xsec_[ 460.0] = 1.237; 	
-  xsec_[ 480.0] = 1.026; 	
-  xsec_[ 500.0] = 0.8491; 	
-  xsec_[ 520.0] = 0.7006; 	
-  xsec_[ 540.0] = 0.5782; 	
-  xsec_[ 560.0] = 0.4771; 	
-  xsec_[ 580.0] = 0.3944; 	
-  xsec_[ 600.0] = 0.3267; 	
-  xsec_[ 620.0] = 0.2713; 	
-  xsec_[ 640.0] = 0.2257; 	
-  xsec_[ 660.0] = 0.1883; 	
-  xsec_[ 680.0] = 0.1574; 	
-  xsec_[ 700.0] = 0.1320; 	
-  xsec_[ 720.0] = 0.1109; 	
-  xsec_[ 740.0] = 0.09335;
-  xsec_[ 760.0] = 0.07883;
-  xsec_[ 780.0] = 0.06668;
-  xsec_[ 800.0] = 0.05655;
-  xsec_[ 820.0] = 0.04806;
-  xsec_[ 840.0] = 0.04089;
-  xsec_[ 860.0] = 0.03490;
-  xsec_[ 880.0] = 0.02982;
-  xsec_[ 900.0] = 0.02555;
-  xsec_[ 920.0] = 0.02193;
-  xsec_[ 940.0] = 0.01885;
-  xsec_[ 960.0] = 0.01624;
-  xsec_[ 980.0] = 0.01400;
-  xsec_[1000.0] = 0.01210;
+  static const float points[][2] = {
+    {  90.0, 29.47 },
+    {  95.0, 26.58 },
+    { 100.0, 24.02 },
+    { 105.0, 21.78 },
+    { 110.0, 19.84 },
+    { 110.5, 19.65 },
+    { 111.0, 19.48 },
+    { 111.5, 19.30 },
+    { 112.0, 19.13 },
+    { 112.5, 18.95 },
+    { 113.0, 18.79 },
+    { 113.5, 18.62 },
+    { 114.0, 18.45 },
+    { 114.5, 18.29 },
+    { 115.0, 18.13 },
+    { 115.5, 17.97 },
+    { 116.0, 17.82 },
+    { 116.5, 17.66 },
+    { 117.0, 17.51 },
+    { 117.5, 17.36 },
+    { 118.0, 17.21 },
+    { 118.5, 17.06 },
+    { 119.0, 16.92 },
+    { 119.5, 16.78 },
+    { 120.0, 16.63 },
+    { 120.5, 16.49 },
+    { 121.0, 16.36 },
+    { 121.5, 16.22 },
+    { 122.0, 16.08 },
+    { 122.5, 15.94 },
+    { 123.0, 15.82 },
+    { 123.5, 15.69 },
+    { 124.0, 15.56 },
+    { 124.5, 15.43 },
+    { 125.0, 15.31 },
+    { 125.5, 15.18 },
+    { 126.0, 15.06 },
+    { 126.5, 14.94 },
+    { 127.0, 14.82 },
+    { 127.5, 14.70 },
+    { 128.0, 14.58 },
+    { 128.5, 14.46 },
+    { 129.0, 14.35 },
+    { 129.5, 14.23 },
+    { 130.0, 14.12 },
+    { 130.5, 14.01 },
+    { 131.0, 13.90 },
+    { 131.5, 13.80 },
+    { 132.0, 13.69 },
+    { 132.5, 13.58 },
+    { 133.0, 13.48 },
+    { 133.5, 13.37 },
+    { 134.0, 13.28 },
+    { 134.5, 13.18 },
+    { 135.0, 13.08 },
+    { 135.5, 12.98 },
+    { 136.0, 12.88 },
+    { 136.5, 12.78 },
+    { 137.0, 12.68 },
+    { 137.5, 12.60 },
+    { 138.0, 12.50 },
+    { 138.5, 12.40 },
+    { 139.0, 12.31 },
+    { 139.5, 12.22 },
+    { 140.0, 12.13 },
+    { 141.0, 11.95 },
+    { 142.0, 11.78 },
+    { 143.0, 11.60 },
+    { 144.0, 11.44 },
+    { 145.0, 11.27 },
+    { 146.0, 11.12 },
+    { 147.0, 10.96 },
+    { 148.0, 10.80 },
+    { 149.0, 10.65 },
+    { 150.0, 10.50 },
+    { 151.0, 10.36 },
+    { 152.0, 10.21 },
+    { 153.0, 10.07 },
+    { 154.0, 9.934 },
+    { 155.0, 9.795 },
+    { 156.0, 9.655 },
+    { 157.0, 9.514 },
+    { 158.0, 9.367 },
+    { 159.0, 9.225 },
+    { 160.0, 9.080 },
+    { 162.0, 8.770 },
+    { 164.0, 8.465 },
+    { 166.0, 8.190 },
+    { 168.0, 7.952 },
+    { 170.0, 7.729 },
+    { 172.0, 7.515 },
+    { 174.0, 7.310 },
+    { 176.0, 7.112 },
+    { 178.0, 6.923 },
+    { 180.0, 6.739 },
+    { 182.0, 6.553 },
+    { 184.0, 6.379 },
+    { 186.0, 6.212 },
+    { 188.0, 6.050 },
+    { 190.0, 5.896 },
+    { 192.0, 5.751 },
+    { 194.0, 5.616 },
+    { 196.0, 5.487 },
+    { 198.0, 5.364 },
+    { 200.0, 5.249 },
+    { 202.0, 5.136 },
+    { 204.0, 5.027 },
+    { 206.0, 4.924 },
+    { 208.0, 4.822 },
+    { 210.0, 4.723 },
+    { 212.0, 4.630 },
+    { 214.0, 4.539 },
+    { 216.0, 4.454 },
+    { 218.0, 4.369 },
+    { 220.0, 4.288 },
+    { 222.0, 4.207 },
+    { 224.0, 4.128 },
+    { 226.0, 4.053 },
+    { 228.0, 3.980 },
+    { 230.0, 3.908 },
+    { 232.0, 3.839 },
+    { 234.0, 3.771 },
+    { 236.0, 3.707 },
+    { 238.0, 3.643 },
+    { 240.0, 3.581 },
+    { 242.0, 3.523 },
+    { 244.0, 3.468 },
+    { 246.0, 3.414 },
+    { 248.0, 3.362 },
+    { 250.0, 3.312 },
+    { 252.0, 3.261 },
+    { 254.0, 3.212 },
+    { 256.0, 3.164 },
+    { 258.0, 3.118 },
+    { 260.0, 3.072 },
+    { 262.0, 3.028 },
+    { 264.0, 2.984 },
+    { 266.0, 2.944 },
+    { 268.0, 2.903 },
+    { 270.0, 2.864 },
+    { 272.0, 2.828 },
+    { 274.0, 2.793 },
+    { 276.0, 2.760 },
+    { 278.0, 2.728 },
+    { 280.0, 2.696 },
+    { 282.0, 2.664 },
+    { 284.0, 2.633 },
+    { 286.0, 2.603 },
+    { 288.0, 2.574 },
+    { 290.0, 2.546 },
+    { 295.0, 2.480 },
+    { 300.0, 2.422 },
+    { 305.0, 2.369 },
+    { 310.0, 2.322 },
+    { 315.0, 2.281 },
+    { 320.0, 2.247 },
+    { 325.0, 2.221 },
+    { 330.0, 2.204 },
+    { 335.0, 2.195 },
+    { 340.0, 2.198 },
+    { 345.0, 2.225 },
+    { 350.0, 2.306 },
+    { 360.0, 2.361 },
+    { 370.0, 2.341 },
+    { 380.0, 2.266 },
+    { 390.0, 2.158 },
+    { 400.0, 2.032 },
+    { 420.0, 1.756 },
+    { 440.0, 1.482 },
+    { 460.0, 1.237 },
+    { 480.0, 1.026 },
+    { 500.0, 0.8491 },
+    { 520.0, 0.7006 },
+    { 540.0, 0.5782 },
+    { 560.0, 0.4771 },
+    { 580.0, 0.3944 },
+    { 600.0, 0.3267 },
+    { 620.0, 0.2713 },
+    { 640.0, 0.2257 },
+    { 660.0, 0.1883 },
+    { 680.0, 0.1574 },
+    { 700.0, 0.1320 },
+    { 720.0, 0.1109 },
+    { 740.0, 0.09335 },
+    { 760.0, 0.07883 },
+    { 780.0, 0.06668 },
+    { 800.0, 0.05655 },
+    { 820.0, 0.04806 },
+    { 840.0, 0.04089 },
+    { 860.0, 0.03490 },
+    { 880.0, 0.02982 },
+    { 900.0, 0.02555 },
+    { 920.0, 0.02193 },
+    { 940.0, 0.01885 },
+    { 960.0, 0.01624 },
+    { 980.0, 0.01400 },
+    {1000.0, 0.01210 }
+  };
+  static const Table table = { points, sizeof(points)/sizeof(points[0]) };
+  return table;
 }
 
-inline void
+inline const CrossSection::Table&
 CrossSection::qqH()
 {
-  xsec_[  90.0] = 1.710; 	
-  xsec_[  95.0] = 1.628; 	
-  xsec_[ 100.0] = 1.546; 	
-  xsec_[ 105.0] = 1.472; 	
-  xsec_[ 110.0] = 1.398; 	
-  xsec_[ 110.5] = 1.391; 	
-  xsec_[ 111.0] = 1.384; 	
-  xsec_[ 111.5] = 1.378; 	
-  xsec_[ 112.0] = 1.371; 	
-  xsec_[ 112.5] = 1.364; 	
-  xsec_[ 113.0] = 1.358; 	
-  xsec_[ 113.5] = 1.351; 	
-  xsec_[ 114.0] = 1.345; 	
-  xsec_[ 114.5] = 1.339; 	
-  xsec_[ 115.0] = 1.332; 	
-  xsec_[ 115.5] = 1.326; 	
-  xsec_[ 116.0] = 1.319; 	
-  xsec_[ 116.5] = 1.313; 	
-  xsec_[ 117.0] = 1.307; 	
-  xsec_[ 117.5] = 1.300; 	
-  xsec_[ 118.0] = 1.294; 	
-  xsec_[ 118.5] = 1.288; 	
-  xsec_[ 119.0] = 1.282; 	
-  xsec_[ 119.5] = 1.276; 	
-  xsec_[ 120.0] = 1.269; 	
-  xsec_[ 120.5] = 1.263; 	
-  xsec_[ 121.0] = 1.257; 	
-  xsec_[ 121.5] = 1.251; 	
-  xsec_[ 122.0] = 1.246; 	
-  xsec_[ 122.5] = 1.240; 	
-  xsec_[ 123.0] = 1.234; 	
-  xsec_[ 123.5] = 1.228; 	
-  xsec_[ 124.0] = 1.222; 	
-  xsec_[ 124.5] = 1.216; 	
-  xsec_[ 125.0] = 1.211; 	
-  xsec_[ 125.5] = 1.205; 	
-  xsec_[ 126.0] = 1.199; 	
-  xsec_[ 126.5] = 1.193; 	
-  xsec_[ 127.0] = 1.188; 	
-  xsec_[ 127.5] = 1.182; 	
-  xsec_[ 128.0] = 1.176; 	
-  xsec_[ 128.5] = 1.171; 	
-  xsec_[ 129.0] = 1.165; 	
-  xsec_[ 129.5] = 1.159; 	
-  xsec_[ 130.0] = 1.154; 	
-  xsec_[ 130.5] = 1.148; 	
-  xsec_[ 131.0] = 1.143; 	
-  xsec_[ 131.5] = 1.137; 	
-  xsec_[ 132.0] = 1.132; 	
-  xsec_[ 132.5] = 1.126; 	
-  xsec_[ 133.0] = 1.121; 	
-  xsec_[ 133.5] = 1.115; 	
-  xsec_[ 134.0] = 1.110; 	
-  xsec_[ 134.5] = 1.105; 	
-  xsec_[ 135.0] = 1.100; 	
-  xsec_[ 135.5] = 1.095; 	
-  xsec_[ 136.0] = 1.090; 	
-  xsec_[ 136.5] = 1.085; 	
-  xsec_[ 137.0] = 1.080; 	
-  xsec_[ 137.5] = 1.076; 	
-  xsec_[ 138.0] = 1.071; 	
-  xsec_[ 138.5] = 1.066; 	
-  xsec_[ 139.0] = 1.062; 	
-  xsec_[ 139.5] = 1.057; 	
-  xsec_[ 140.0] = 1.052; 	
-  xsec_[ 141.0] = 1.043; 	
-  xsec_[ 142.0] = 1.033; 	
-  xsec_[ 143.0] = 1.023; 	
-  xsec_[ 144.0] = 1.013; 	
-  xsec_[ 145.0] = 1.004; 	
-  xsec_[ 146.0] = 0.9951; 	
-  xsec_[ 147.0] = 0.9866; 	
-  xsec_[ 148.0] = 0.9782; 	
-  xsec_[ 149.0] = 0.9699; 	
-  xsec_[ 150.0] = 0.9617; 	
-  xsec_[ 151.0] = 0.9529; 	
-  xsec_[ 152.0] = 0.9441; 	
-  xsec_[ 153.0] = 0.9353; 	
-  xsec_[ 154.0] = 0.9266; 	
-  xsec_[ 155.0] = 0.9180; 	
-  xsec_[ 156.0] = 0.9095; 	
-  xsec_[ 157.0] = 0.9013; 	
-  xsec_[ 158.0] = 0.8934; 	
-  xsec_[ 159.0] = 0.8859; 	
-  xsec_[ 160.0] = 0.8787; 	
-  xsec_[ 162.0] = 0.8676; 	
-  xsec_[ 164.0] = 0.8571; 	
-  xsec_[ 166.0] = 0.8453; 	
-  xsec_[ 168.0] = 0.8316; 	
-  xsec_[ 170.0] = 0.8173; 	
-  xsec_[ 172.0] = 0.8029; 	
-  xsec_[ 174.0] = 0.7885; 	
-  xsec_[ 176.0] = 0.7744; 	
-  xsec_[ 178.0] = 0.7609; 	
-  xsec_[ 180.0] = 0.7480; 	
-  xsec_[ 182.0] = 0.7361; 	
-  xsec_[ 184.0] = 0.7248; 	
-  xsec_[ 186.0] = 0.7139; 	
-  xsec_[ 188.0] = 0.7032; 	
-  xsec_[ 190.0] = 0.6925; 	
-  xsec_[ 192.0] = 0.6812; 	
-  xsec_[ 194.0] = 0.6699; 	
-  xsec_[ 196.0] = 0.6587; 	
-  xsec_[ 198.0] = 0.6478; 	
-  xsec_[ 200.0] = 0.6371; 	
-  xsec_[ 202.0] = 0.6267; 	
-  xsec_[ 204.0] = 0.6164; 	
-  xsec_[ 206.0] = 0.6064; 	
-  xsec_[ 208.0] = 0.5965; 	
-  xsec_[ 210.0] = 0.5869; 	
-  xsec_[ 212.0] = 0.5775; 	
-  xsec_[ 214.0] = 0.5684; 	
-  xsec_[ 216.0] = 0.5594; 	
-  xsec_[ 218.0] = 0.5506; 	
-  xsec_[ 220.0] = 0.5420; 	
-  xsec_[ 222.0] = 0.5335; 	
-  xsec_[ 224.0] = 0.5252; 	
-  xsec_[ 226.0] = 0.5170; 	
-  xsec_[ 228.0] = 0.5089; 	
-  xsec_[ 230.0] = 0.5011; 	
-  xsec_[ 232.0] = 0.4934; 	
-  xsec_[ 234.0] = 0.4859; 	
-  xsec_[ 236.0] = 0.4785; 	
-  xsec_[ 238.0] = 0.4712; 	
-  xsec_[ 240.0] = 0.4641; 	
-  xsec_[ 242.0] = 0.4572; 	
-  xsec_[ 244.0] = 0.4503; 	
-  xsec_[ 246.0] = 0.4436; 	
-  xsec_[ 248.0] = 0.4369; 	
-  xsec_[ 250.0] = 0.4304; 	
-  xsec_[ 252.0] = 0.4239; 	
-  xsec_[ 254.0] = 0.4174; 	
-  xsec_[ 256.0] = 0.4111; 	
-  xsec_[ 258.0] = 0.4049; 	
-  xsec_[ 260.0] = 0.3988; 	
-  xsec_[ 262.0] = 0.3931; 	
-  xsec_[ 264.0] = 0.3875; 	
-  xsec_[ 266.0] = 0.3821; 	
-  xsec_[ 268.0] = 0.3767; 	
-  xsec_[ 270.0] = 0.3715; 	
-  xsec_[ 272.0] = 0.3663; 	
-  xsec_[ 274.0] = 0.3611; 	
-  xsec_[ 276.0] = 0.3560; 	
-  xsec_[ 278.0] = 0.3510; 	
-  xsec_[ 280.0] = 0.3461; 	
-  xsec_[ 282.0] = 0.3413; 	
-  xsec_[ 284.0] = 0.3365; 	
-  xsec_[ 286.0] = 0.3318; 	
-  xsec_[ 288.0] = 0.3271; 	
-  xsec_[ 290.0] = 0.3226; 	
-  xsec_[ 295.0] = 0.3116; 	
-  xsec_[ 300.0] = 0.3011; 	
-  xsec_[ 305.0] = 0.2908; 	
-  xsec_[ 310.0] = 0.2809; 	
-  xsec_[ 315.0] = 0.2716; 	
-  xsec_[ 320.0] = 0.2627; 	
-  xsec_[ 325.0] = 0.2539; 	
-  xsec_[ 330.0] = 0.2453; 	
-  xsec_[ 335.0] = 0.2368; 	
-  xsec_[ 340.0] = 0.2286; 	
-  xsec_[ 345.0] = 0.2206; 	
-  xsec_[ 350.0] = 0.2132; 	
-  xsec_[ 360.0] = 0.2018; 	
-  xsec_[ 370.0] = 0.1910; 	
-  xsec_[ 380.0] = 0.1808; 	
-  xsec_[ 390.0] = 0.1712; 	
-  xsec_[ 400.0] = 0.1620; 	
-  xsec_[ 420.0] = 0.1451; 	
-  xsec_[ 440.0] = 0.1304; 	
-  xsec_[ 460.0] = 0.1171; 	
-  xsec_[ 480.0] = 0.1054; 	
-  xsec_[ 500.0] = 0.09497; 
-  xsec_[ 520.0] = 0.08568; 
-  xsec_[ 540.0] = 0.07746; 
-  xsec_[ 560.0] = 0.07010; 
-  xsec_[ 580.0] = 0.06353; 
-  xsec_[ 600.0] = 0.05771; 
-  xsec_[ 620.0] = 0.05246; 
-  xsec_[ 640.0] = 0.04776; 
-  xsec_[ 660.0] = 0.04356; 
-  xsec_[ 680.0] = 0.03977; 
-  xsec_[ 700.0] = 0.03637; 
-  xsec_[ 720.0] = 0.03330; 
-  xsec_[ 740.0] = 0.03052; 
-  xsec_[ 760.0] = 0.02805; 
-  xsec_[ 780.0] = 0.02580; 
-  xsec_[ 800.0] = 0.02373; 
-  xsec_[ 820.0] = 0.02188; 
-  xsec_[ 840.0] = 0.02018; 
-  xsec_[ 860.0] = 0.01864; 
-  xsec_[ 880.0] = 0.01724; 
-  xsec_[ 900.0] = 0.01597; 
-  xsec_[ 920.0] = 0.01479; 
-  xsec_[ 940.0] = 0.01375; 
-  xsec_[ 960.0] = 0.01275; 
-  xsec_[ 980.0] = 0.01186; 
-  xsec_[1000.0] = 0.01104; 
+  static const float points[][2] = {
+    {  90.0, 1.710 },
+    {  95.0, 1.628 },
+    { 100.0, 1.546 },
+    { 105.0, 1.472 },
+    { 110.0, 1.398 },
+    { 110.5, 1.391 },
+    { 111.0, 1.384 },
+    { 111.5, 1.378 },
+    { 112.0, 1.371 },
+    { 112.5, 1.364 },
+    { 113.0, 1.358 },
+    { 113.5, 1.351 },
+    { 114.0, 1.345 },
+    { 114.5, 1.339 },
+    { 115.0, 1.332 },
+    { 115.5, 1.326 },
+    { 116.0, 1.319 },
+    { 116.5, 1.313 },
+    { 117.0, 1.307 },
+    { 117.5, 1.300 },
+    { 118.0, 1.294 },
+    { 118.5, 1.288 },
+    { 119.0, 1.282 },
+    { 119.5, 1.276 },
+    { 120.0, 1.269 },
+    { 120.5, 1.263 },
+    { 121.0, 1.257 },
+    { 121.5, 1.251 },
+    { 122.0, 1.246 },
+    { 122.5, 1.240 },
+    { 123.0, 1.234 },
+    { 123.5, 1.228 },
+    { 124.0, 1.222 },
+    { 124.5, 1.216 },
+    { 125.0, 1.211 },
+    { 125.5, 1.205 },
+    { 126.0, 1.199 },
+    { 126.5, 1.193 },
+    { 127.0, 1.188 },
+    { 127.5, 1.182 },
+    { 128.0, 1.176 },
+    { 128.5, 1.171 },
+    { 129.0, 1.165 },
+    { 129.5, 1.159 },
+    { 130.0, 1.154 },
+    { 130.5, 1.148 },
+    { 131.0, 1.143 },
+    { 131.5, 1.137 },
+    { 132.0, 1.132 },
+    { 132.5, 1.126 },
+    { 133.0, 1.121 },
+    { 133.5, 1.115 },
+    { 134.0, 1.110 },
+    { 134.5, 1.105 },
+    { 135.0, 1.100 },
+    { 135.5, 1.095 },
+    { 136.0, 1.090 },
+    { 136.5, 1.085 },
+    { 137.0, 1.080 },
+    { 137.5, 1.076 },
+    { 138.0, 1.071 },
+    { 138.5, 1.066 },
+    { 139.0, 1.062 },
+    { 139.5, 1.057 },
+    { 140.0, 1.052 },
+    { 141.0, 1.043 },
+    { 142.0, 1.033 },
+    { 143.0, 1.023 },
+    { 144.0, 1.013 },
+    { 145.0, 1.004 },
+    { 146.0, 0.9951 },
+    { 147.0, 0.9866 },
+    { 148.0, 0.9782 },
+    { 149.0, 0.9699 },
+    { 150.0, 0.9617 },
+    { 151.0, 0.9529 },
+    { 152.0, 0.9441 },
+    { 153.0, 0.9353 },
+    { 154.0, 0.9266 },
+    { 155.0, 0.9180 },
+    { 156.0, 0.9095 },
+    { 157.0, 0.9013 },
+    { 158.0, 0.8934 },
+    { 159.0, 0.8859 },
+    { 160.0, 0.8787 },
+    { 162.0, 0.8676 },
+    { 164.0, 0.8571 },
+    { 166.0, 0.8453 },
+    { 168.0, 0.8316 },
+    { 170.0, 0.8173 },
+    { 172.0, 0.8029 },
+    { 174.0, 0.7885 },
+    { 176.0, 0.7744 },
+    { 178.0, 0.7609 },
+    { 180.0, 0.7480 },
+    { 182.0, 0.7361 },
+    { 184.0, 0.7248 },
+    { 186.0, 0.7139 },
+    { 188.0, 0.7032 },
+    { 190.0, 0.6925 },
+    { 192.0, 0.6812 },
+    { 194.0, 0.6699 },
+    { 196.0, 0.6587 },
+    { 198.0, 0.6478 },
+    { 200.0, 0.6371 },
+    { 202.0, 0.6267 },
+    { 204.0, 0.6164 },
+    { 206.0, 0.6064 },
+    { 208.0, 0.5965 },
+    { 210.0, 0.5869 },
+    { 212.0, 0.5775 },
+    { 214.0, 0.5684 },
+    { 216.0, 0.5594 },
+    { 218.0, 0.5506 },
+    { 220.0, 0.5420 },
+    { 222.0, 0.5335 },
+    { 224.0, 0.5252 },
+    { 226.0, 0.5170 },
+    { 228.0, 0.5089 },
+    { 230.0, 0.5011 },
+    { 232.0, 0.4934 },
+    { 234.0, 0.4859 },
+    { 236.0, 0.4785 },
+    { 238.0, 0.4712 },
+    { 240.0, 0.4641 },
+    { 242.0, 0.4572 },
+    { 244.0, 0.4503 },
+    { 246.0, 0.4436 },
+    { 248.0, 0.4369 },
+    { 250.0, 0.4304 },
+    { 252.0, 0.4239 },
+    { 254.0, 0.4174 },
+    { 256.0, 0.4111 },
+    { 258.0, 0.4049 },
+    { 260.0, 0.3988 },
+    { 262.0, 0.3931 },
+    { 264.0, 0.3875 },
+    { 266.0, 0.3821 },
+    { 268.0, 0.3767 },
+    { 270.0, 0.3715 },
+    { 272.0, 0.3663 },
+    { 274.0, 0.3611 },
+    { 276.0, 0.3560 },
+    { 278.0, 0.3510 },
+    { 280.0, 0.3461 },
+    { 282.0, 0.3413 },
+    { 284.0, 0.3365 },
+    { 286.0, 0.3318 },
+    { 288.0, 0.3271 },
+    { 290.0, 0.3226 },
+    { 295.0, 0.3116 },
+    { 300.0, 0.3011 },
+    { 305.0, 0.2908 },
+    { 310.0, 0.2809 },
+    { 315.0, 0.2716 },
+    { 320.0, 0.2627 },
+    { 325.0, 0.2539 },
+    { 330.0, 0.2453 },
+    { 335.0, 0.2368 },
+    { 340.0, 0.2286 },
+    { 345.0, 0.2206 },
+    { 350.0, 0.2132 },
+    { 360.0, 0.2018 },
+    { 370.0, 0.1910 },
+    { 380.0, 0.1808 },
+    { 390.0, 0.1712 },
+    { 400.0, 0.1620 },
+    { 420.0, 0.1451 },
+    { 440.0, 0.1304 },
+    { 460.0, 0.1171 },
+    { 480.0, 0.1054 },
+    { 500.0, 0.09497 },
+    { 520.0, 0.08568 },
+    { 540.0, 0.07746 },
+    { 560.0, 0.07010 },
+    { 580.0, 0.06353 },
+    { 600.0, 0.05771 },
+    { 620.0, 0.05246 },
+    { 640.0, 0.04776 },
+    { 660.0, 0.04356 },
+    { 680.0, 0.03977 },
+    { 700.0, 0.03637 },
+    { 720.0, 0.03330 },
+    { 740.0, 0.03052 },
+    { 760.0, 0.02805 },
+    { 780.0, 0.02580 },
+    { 800.0, 0.02373 },
+    { 820.0, 0.02188 },
+    { 840.0, 0.02018 },
+    { 860.0, 0.01864 },
+    { 880.0, 0.01724 },
+    { 900.0, 0.01597 },
+    { 920.0, 0.01479 },
+    { 940.0, 0.01375 },
+    { 960.0, 0.01275 },
+    { 980.0, 0.01186 },
+    {1000.0, 0.01104 }
+  };
+  static const Table table = { points, sizeof(points)/sizeof(points[0]) };
+  return table;
 }
 
-inline void
+inline const CrossSection::Table&
 CrossSection::WH()
 {
-  xsec_[ 90.0] = 1.640; 	
-  xsec_[ 95.0] = 1.392;	
-  xsec_[100.0] = 1.186; 	
-  xsec_[105.0] = 1.018; 	
-  xsec_[110.0] = 0.8754; 	
-  xsec_[110.5] = 0.8623; 	
-  xsec_[111.0] = 0.8495; 	
-  xsec_[111.5] = 0.8368; 	
-  xsec_[112.0] = 0.8244; 	
-  xsec_[112.5] = 0.8122; 	
-  xsec_[113.0] = 0.8003; 	
-  xsec_[113.5] = 0.7885; 	
-  xsec_[114.0] = 0.7770; 	
-  xsec_[114.5] = 0.7657; 	
-  xsec_[115.0] = 0.7546; 	
-  xsec_[115.5] = 0.7439; 	
-  xsec_[116.0] = 0.7333; 	
-  xsec_[116.5] = 0.7230; 	
-  xsec_[117.0] = 0.7129; 	
-  xsec_[117.5] = 0.7030; 	
-  xsec_[118.0] = 0.6933; 	
-  xsec_[118.5] = 0.6837; 	
-  xsec_[119.0] = 0.6744; 	
-  xsec_[119.5] = 0.6651; 	
-  xsec_[120.0] = 0.6561; 	
-  xsec_[120.5] = 0.6472; 	
-  xsec_[121.0] = 0.6384; 	
-  xsec_[121.5] = 0.6297; 	
-  xsec_[122.0] = 0.6212; 	
-  xsec_[122.5] = 0.6129; 	
-  xsec_[123.0] = 0.6046; 	
-  xsec_[123.5] = 0.5965; 	
-  xsec_[124.0] = 0.5885; 	
-  xsec_[124.5] = 0.5806; 	
-  xsec_[125.0] = 0.5729; 	
-  xsec_[125.5] = 0.5652; 	
-  xsec_[126.0] = 0.5576; 	
-  xsec_[126.5] = 0.5501; 	
-  xsec_[127.0] = 0.5428; 	
-  xsec_[127.5] = 0.5355; 	
-  xsec_[128.0] = 0.5284; 	
-  xsec_[128.5] = 0.5213; 	
-  xsec_[129.0] = 0.5144; 	
-  xsec_[129.5] = 0.5075; 	
-  xsec_[130.0] = 0.5008; 	
-  xsec_[130.5] = 0.4942; 	
-  xsec_[131.0] = 0.4877; 	
-  xsec_[131.5] = 0.4813; 	
-  xsec_[132.0] = 0.4749; 	
-  xsec_[132.5] = 0.4687; 	
-  xsec_[133.0] = 0.4626; 	
-  xsec_[133.5] = 0.4566; 	
-  xsec_[134.0] = 0.4506; 	
-  xsec_[134.5] = 0.4448; 	
-  xsec_[135.0] = 0.4390; 	
-  xsec_[135.5] = 0.4333; 	
-  xsec_[136.0] = 0.4277; 	
-  xsec_[136.5] = 0.4221; 	
-  xsec_[137.0] = 0.4167; 	
-  xsec_[137.5] = 0.4113; 	
-  xsec_[138.0] = 0.4060; 	
-  xsec_[138.5] = 0.4008; 	
-  xsec_[139.0] = 0.3957; 	
-  xsec_[139.5] = 0.3907; 	
-  xsec_[140.0] = 0.3857; 	
-  xsec_[141.0] = 0.3761; 	
-  xsec_[142.0] = 0.3669; 	
-  xsec_[143.0] = 0.3579; 	
-  xsec_[144.0] = 0.3491; 	
-  xsec_[145.0] = 0.3406; 	
-  xsec_[146.0] = 0.3321; 	
-  xsec_[147.0] = 0.3238; 	
-  xsec_[148.0] = 0.3157; 	
-  xsec_[149.0] = 0.3078; 	
-  xsec_[150.0] = 0.3001; 	
-  xsec_[151.0] = 0.2928; 	
-  xsec_[152.0] = 0.2856; 	
-  xsec_[153.0] = 0.2785; 	
-  xsec_[154.0] = 0.2715; 	
-  xsec_[155.0] = 0.2646; 	
-  xsec_[156.0] = 0.2569; 	
-  xsec_[157.0] = 0.2494; 	
-  xsec_[158.0] = 0.2422; 	
-  xsec_[159.0] = 0.2354; 	
-  xsec_[160.0] = 0.2291; 	
-  xsec_[162.0] = 0.2209; 	
-  xsec_[164.0] = 0.2140; 	
-  xsec_[166.0] = 0.2063; 	
-  xsec_[168.0] = 0.1973; 	
-  xsec_[170.0] = 0.1883; 	
-  xsec_[172.0] = 0.1802; 	
-  xsec_[174.0] = 0.1726; 	
-  xsec_[176.0] = 0.1653; 	
-  xsec_[178.0] = 0.1585; 	
-  xsec_[180.0] = 0.1521; 	
-  xsec_[182.0] = 0.1465; 	
-  xsec_[184.0] = 0.1413; 	
-  xsec_[186.0] = 0.1360; 	
-  xsec_[188.0] = 0.1305; 	
-  xsec_[190.0] = 0.1253; 	
-  xsec_[192.0] = 0.1205; 	
-  xsec_[194.0] = 0.1160; 	
-  xsec_[196.0] = 0.1116; 	
-  xsec_[198.0] = 0.1073; 	
-  xsec_[200.0] = 0.1032; 	
-  xsec_[202.0] = 0.09932; 
-  xsec_[204.0] = 0.09563; 
-  xsec_[206.0] = 0.09212; 
-  xsec_[208.0] = 0.08877; 
-  xsec_[210.0] = 0.08557; 
-  xsec_[212.0] = 0.08248; 
-  xsec_[214.0] = 0.07953; 
-  xsec_[216.0] = 0.07671; 
-  xsec_[218.0] = 0.07400; 
-  xsec_[220.0] = 0.07142; 
-  xsec_[222.0] = 0.06895; 
-  xsec_[224.0] = 0.06658; 
-  xsec_[226.0] = 0.06432; 
-  xsec_[228.0] = 0.06214; 
-  xsec_[230.0] = 0.06006; 
-  xsec_[232.0] = 0.05805; 
-  xsec_[234.0] = 0.05611; 
-  xsec_[236.0] = 0.05425; 
-  xsec_[238.0] = 0.05247; 
-  xsec_[240.0] = 0.05075; 
-  xsec_[242.0] = 0.04909; 
-  xsec_[244.0] = 0.04750; 
-  xsec_[246.0] = 0.04597; 
-  xsec_[248.0] = 0.04450; 
-  xsec_[250.0] = 0.04308; 
-  xsec_[252.0] = 0.04171; 
-  xsec_[254.0] = 0.04040; 
-  xsec_[256.0] = 0.03913; 
-  xsec_[258.0] = 0.03791; 
-  xsec_[260.0] = 0.03674; 
-  xsec_[262.0] = 0.03561; 
-  xsec_[264.0] = 0.03451; 
-  xsec_[266.0] = 0.03346; 
-  xsec_[268.0] = 0.03244; 
-  xsec_[270.0] = 0.03146; 
-  xsec_[272.0] = 0.03050; 
-  xsec_[274.0] = 0.02958; 
-  xsec_[276.0] = 0.02869; 
-  xsec_[278.0] = 0.02783; 
-  xsec_[280.0] = 0.02700; 
-  xsec_[282.0] = 0.02621; 
-  xsec_[284.0] = 0.02545; 
-  xsec_[286.0] = 0.02472; 
-  xsec_[288.0] = 0.02401; 
-  xsec_[290.0] = 0.02333; 
-  xsec_[295.0] = 0.02168; 
-  xsec_[300.0] = 0.02018; 
+  static const float points[][2] = {
+    { 90.0, 1.640 },
+    { 95.0, 1.392 },
+    {100.0, 1.186 },
+    {105.0, 1.018 },
+    {110.0, 0.8754 },
+    {110.5, 0.8623 },
+    {111.0, 0.8495 },
+    {111.5, 0.8368 },
+    {112.0, 0.8244 },
+    {112.5, 0.8122 },
+    {113.0, 0.8003 },
+    {113.5, 0.7885 },
+    {114.0, 0.7770 },
+    {114.5, 0.7657 },
+    {115.0, 0.7546 },
+    {115.5, 0.7439 },
+    {116.0, 0.7333 },
+    {116.5, 0.7230 },
+    {117.0, 0.7129 },
+    {117.5, 0.7030 },
+    {118.0, 0.6933 },
+    {118.5, 0.6837 },
+    {119.0, 0.6744 },
+    {119.5, 0.6651 },
+    {120.0, 0.6561 },
+    {120.5, 0.6472 },
+    {121.0, 0.6384 },
+    {121.5, 0.6297 },
+    {122.0, 0.6212 },
+    {122.5, 0.6129 },
+    {123.0, 0.6046 },
+    {123.5, 0.5965 },
+    {124.0, 0.5885 },
+    {124.5, 0.5806 },
+    {125.0, 0.5729 },
+    {125.5, 0.5652 },
+    {126.0, 0.5576 },
+    {126.5, 0.5501 },
+    {127.0, 0.5428 },
+    {127.5, 0.5355 },
+    {128.0, 0.5284 },
+    {128.5, 0.5213 },
+    {129.0, 0.5144 },
+    {129.5, 0.5075 },
+    {130.0, 0.5008 },
+    {130.5, 0.4942 },
+    {131.0, 0.4877 },
+    {131.5, 0.4813 },
+    {132.0, 0.4749 },
+    {132.5, 0.4687 },
+    {133.0, 0.4626 },
+    {133.5, 0.4566 },
+    {134.0, 0.4506 },
+    {134.5, 0.4448 },
+    {135.0, 0.4390 },
+    {135.5, 0.4333 },
+    {136.0, 0.4277 },
+    {136.5, 0.4221 },
+    {137.0, 0.4167 },
+    {137.5, 0.4113 },
+    {138.0, 0.4060 },
+    {138.5, 0.4008 },
+    {139.0, 0.3957 },
+    {139.5, 0.3907 },
+    {140.0, 0.3857 },
+    {141.0, 0.3761 },
+    {142.0, 0.3669 },
+    {143.0, 0.3579 },
+    {144.0, 0.3491 },
+    {145.0, 0.3406 },
+    {146.0, 0.3321 },
+    {147.0, 0.3238 },
+    {148.0, 0.3157 },
+    {149.0, 0.3078 },
+    {150.0, 0.3001 },
+    {151.0, 0.2928 },
+    {152.0, 0.2856 },
+    {153.0, 0.2785 },
+    {154.0, 0.2715 },
+    {155.0, 0.2646 },
+    {156.0, 0.2569 },
+    {157.0, 0.2494 },
+    {158.0, 0.2422 },
+    {159.0, 0.2354 },
+    {160.0, 0.2291 },
+    {162.0, 0.2209 },
+    {164.0, 0.2140 },
+    {166.0, 0.2063 },
+    {168.0, 0.1973 },
+    {170.0, 0.1883 },
+    {172.0, 0.1802 },
+    {174.0, 0.1726 },
+    {176.0, 0.1653 },
+    {178.0, 0.1585 },
+    {180.0, 0.1521 },
+    {182.0, 0.1465 },
+    {184.0, 0.1413 },
+    {186.0, 0.1360 },
+    {188.0, 0.1305 },
+    {190.0, 0.1253 },
+    {192.0, 0.1205 },
+    {194.0, 0.1160 },
+    {196.0, 0.1116 },
+    {198.0, 0.1073 },
+    {200.0, 0.1032 },
+    {202.0, 0.09932 },
+    {204.0, 0.09563 },
+    {206.0, 0.09212 },
+    {208.0, 0.08877 },
+    {210.0, 0.08557 },
+    {212.0, 0.08248 },
+    {214.0, 0.07953 },
+    {216.0, 0.07671 },
+    {218.0, 0.07400 },
+    {220.0, 0.07142 },
+    {222.0, 0.06895 },
+    {224.0, 0.06658 },
+    {226.0, 0.06432 },
+    {228.0, 0.06214 },
+    {230.0, 0.06006 },
+    {232.0, 0.05805 },
+    {234.0, 0.05611 },
+    {236.0, 0.05425 },
+    {238.0, 0.05247 },
+    {240.0, 0.05075 },
+    {242.0, 0.04909 },
+    {244.0, 0.04750 },
+    {246.0, 0.04597 },
+    {248.0, 0.04450 },
+    {250.0, 0.04308 },
+    {252.0, 0.04171 },
+    {254.0, 0.04040 },
+    {256.0, 0.03913 },
+    {258.0, 0.03791 },
+    {260.0, 0.03674 },
+    {262.0, 0.03561 },
+    {264.0, 0.03451 },
+    {266.0, 0.03346 },
+    {268.0, 0.03244 },
+    {270.0, 0.03146 },
+    {272.0, 0.03050 },
+    {274.0, 0.02958 },
+    {276.0, 0.02869 },
+    {278.0, 0.02783 },
+    {280.0, 0.02700 },
+    {282.0, 0.02621 },
+    {284.0, 0.02545 },
+    {286.0, 0.02472 },
+    {288.0, 0.02401 },
+    {290.0, 0.02333 },
+    {295.0, 0.02168 },
+    {300.0, 0.02018 }
+  };
+  static const Table table = { points, sizeof(points)/sizeof(points[0]) };
+  return table;
 }
 
-inline void
+inline const CrossSection::Table&
 CrossSection::ZH()
 {
-  xsec_[ 90.0] = 0.8597; 	
-  xsec_[ 95.0] = 0.7348; 	
-  xsec_[100.0] = 0.6313; 	
-  xsec_[105.0] = 0.5449; 	
-  xsec_[110.0] = 0.4721; 	
-  xsec_[110.5] = 0.4655; 	
-  xsec_[111.0] = 0.4589; 	
-  xsec_[111.5] = 0.4525; 	
-  xsec_[112.0] = 0.4462; 	
-  xsec_[112.5] = 0.4400; 	
-  xsec_[113.0] = 0.4340; 	
-  xsec_[113.5] = 0.4280; 	
-  xsec_[114.0] = 0.4221; 	
-  xsec_[114.5] = 0.4164; 	
-  xsec_[115.0] = 0.4107; 	
-  xsec_[115.5] = 0.4052; 	
-  xsec_[116.0] = 0.3998; 	
-  xsec_[116.5] = 0.3945; 	
-  xsec_[117.0] = 0.3893; 	
-  xsec_[117.5] = 0.3842; 	
-  xsec_[118.0] = 0.3791; 	
-  xsec_[118.5] = 0.3742; 	
-  xsec_[119.0] = 0.3693; 	
-  xsec_[119.5] = 0.3645; 	
-  xsec_[120.0] = 0.3598; 	
-  xsec_[120.5] = 0.3551; 	
-  xsec_[121.0] = 0.3505; 	
-  xsec_[121.5] = 0.3459; 	
-  xsec_[122.0] = 0.3414; 	
-  xsec_[122.5] = 0.3370; 	
-  xsec_[123.0] = 0.3326; 	
-  xsec_[123.5] = 0.3283; 	
-  xsec_[124.0] = 0.3241; 	
-  xsec_[124.5] = 0.3199; 	
-  xsec_[125.0] = 0.3158; 	
-  xsec_[125.5] = 0.3117; 	
-  xsec_[126.0] = 0.3077; 	
-  xsec_[126.5] = 0.3038; 	
-  xsec_[127.0] = 0.2999; 	
-  xsec_[127.5] = 0.2961; 	
-  xsec_[128.0] = 0.2923; 	
-  xsec_[128.5] = 0.2886; 	
-  xsec_[129.0] = 0.2849; 	
-  xsec_[129.5] = 0.2813; 	
-  xsec_[130.0] = 0.2778; 	
-  xsec_[130.5] = 0.2743; 	
-  xsec_[131.0] = 0.2709; 	
-  xsec_[131.5] = 0.2675; 	
-  xsec_[132.0] = 0.2642; 	
-  xsec_[132.5] = 0.2609; 	
-  xsec_[133.0] = 0.2577; 	
-  xsec_[133.5] = 0.2545; 	
-  xsec_[134.0] = 0.2514; 	
-  xsec_[134.5] = 0.2483; 	
-  xsec_[135.0] = 0.2453; 	
-  xsec_[135.5] = 0.2423; 	
-  xsec_[136.0] = 0.2393; 	
-  xsec_[136.5] = 0.2364; 	
-  xsec_[137.0] = 0.2336; 	
-  xsec_[137.5] = 0.2307; 	
-  xsec_[138.0] = 0.2279; 	
-  xsec_[138.5] = 0.2252; 	
-  xsec_[139.0] = 0.2225; 	
-  xsec_[139.5] = 0.2198; 	
-  xsec_[140.0] = 0.2172; 	
-  xsec_[141.0] = 0.2121; 	
-  xsec_[142.0] = 0.2071; 	
-  xsec_[143.0] = 0.2023; 	
-  xsec_[144.0] = 0.1976; 	
-  xsec_[145.0] = 0.1930; 	
-  xsec_[146.0] = 0.1884; 	
-  xsec_[147.0] = 0.1840; 	
-  xsec_[148.0] = 0.1796; 	
-  xsec_[149.0] = 0.1754; 	
-  xsec_[150.0] = 0.1713; 	
-  xsec_[151.0] = 0.1674; 	
-  xsec_[152.0] = 0.1636; 	
-  xsec_[153.0] = 0.1599; 	
-  xsec_[154.0] = 0.1562; 	
-  xsec_[155.0] = 0.1525; 	
-  xsec_[156.0] = 0.1484; 	
-  xsec_[157.0] = 0.1444; 	
-  xsec_[158.0] = 0.1405; 	
-  xsec_[159.0] = 0.1368; 	
-  xsec_[160.0] = 0.1334; 	
-  xsec_[162.0] = 0.1289; 	
-  xsec_[164.0] = 0.1252; 	
-  xsec_[166.0] = 0.1208; 	
-  xsec_[168.0] = 0.1157; 	
-  xsec_[170.0] = 0.1106; 	
-  xsec_[172.0] = 0.1060; 	
-  xsec_[174.0] = 0.1016; 	
-  xsec_[176.0] = 0.09732; 
-  xsec_[178.0] = 0.09310; 
-  xsec_[180.0] = 0.08917; 
-  xsec_[182.0] = 0.08589; 
-  xsec_[184.0] = 0.08286; 
-  xsec_[186.0] = 0.07981; 
-  xsec_[188.0] = 0.07668; 
-  xsec_[190.0] = 0.07366; 
-  xsec_[192.0] = 0.07089; 
-  xsec_[194.0] = 0.06826; 
-  xsec_[196.0] = 0.06573; 
-  xsec_[198.0] = 0.06330; 
-  xsec_[200.0] = 0.06096; 
-  xsec_[202.0] = 0.05872; 
-  xsec_[204.0] = 0.05658; 
-  xsec_[206.0] = 0.05453; 
-  xsec_[208.0] = 0.05256; 
-  xsec_[210.0] = 0.05068; 
-  xsec_[212.0] = 0.04887; 
-  xsec_[214.0] = 0.04713; 
-  xsec_[216.0] = 0.04547; 
-  xsec_[218.0] = 0.04388; 
-  xsec_[220.0] = 0.04235; 
-  xsec_[222.0] = 0.04089; 
-  xsec_[224.0] = 0.03949; 
-  xsec_[226.0] = 0.03814; 
-  xsec_[228.0] = 0.03684; 
-  xsec_[230.0] = 0.03560; 
-  xsec_[232.0] = 0.03439; 
-  xsec_[234.0] = 0.03323; 
-  xsec_[236.0] = 0.03210; 
-  xsec_[238.0] = 0.03103; 
-  xsec_[240.0] = 0.02999; 
-  xsec_[242.0] = 0.02900; 
-  xsec_[244.0] = 0.02805; 
-  xsec_[246.0] = 0.02713; 
-  xsec_[248.0] = 0.02625; 
-  xsec_[250.0] = 0.02540; 
-  xsec_[252.0] = 0.02458; 
-  xsec_[254.0] = 0.02379; 
-  xsec_[256.0] = 0.02302; 
-  xsec_[258.0] = 0.02229; 
-  xsec_[260.0] = 0.02158; 
-  xsec_[262.0] = 0.02089; 
-  xsec_[264.0] = 0.02023; 
-  xsec_[266.0] = 0.01960; 
-  xsec_[268.0] = 0.01898; 
-  xsec_[270.0] = 0.01839; 
-  xsec_[272.0] = 0.01782; 
-  xsec_[274.0] = 0.01727; 
-  xsec_[276.0] = 0.01675; 
-  xsec_[278.0] = 0.01624; 
-  xsec_[280.0] = 0.01575; 
-  xsec_[282.0] = 0.01528; 
-  xsec_[284.0] = 0.01482; 
-  xsec_[286.0] = 0.01438; 
-  xsec_[288.0] = 0.01396; 
-  xsec_[290.0] = 0.01355; 
-  xsec_[295.0] = 0.01257; 
-  xsec_[300.0] = 0.01169; 
+  static const float points[][2] = {
+    { 90.0, 0.8597 },
+    { 95.0, 0.7348 },
+    {100.0, 0.6313 },
+    {105.0, 0.5449 },
+    {110.0, 0.4721 },
+    {110.5, 0.4655 },
+    {111.0, 0.4589 },
+    {111.5, 0.4525 },
+    {112.0, 0.4462 },
+    {112.5, 0.4400 },
+    {113.0, 0.4340 },
+    {113.5, 0.4280 },
+    {114.0, 0.4221 },
+    {114.5, 0.4164 },
+    {115.0, 0.4107 },
+    {115.5, 0.4052 },
+    {116.0, 0.3998 },
+    {116.5, 0.3945 },
+    {117.0, 0.3893 },
+    {117.5, 0.3842 },
+    {118.0, 0.3791 },
+    {118.5, 0.3742 },
+    {119.0, 0.3693 },
+    {119.5, 0.3645 },
+    {120.0, 0.3598 },
+    {120.5, 0.3551 },
+    {121.0, 0.3505 },
+    {121.5, 0.3459 },
+    {122.0, 0.3414 },
+    {122.5, 0.3370 },
+    {123.0, 0.3326 },
+    {123.5, 0.3283 },
+    {124.0, 0.3241 },
+    {124.5, 0.3199 },
+    {125.0, 0.3158 },
+    {125.5, 0.3117 },
+    {126.0, 0.3077 },
+    {126.5, 0.3038 },
+    {127.0, 0.2999 },
+    {127.5, 0.2961 },
+    {128.0, 0.2923 },
+    {128.5, 0.2886 },
+    {129.0, 0.2849 },
+    {129.5, 0.2813 },
+    {130.0, 0.2778 },
+    {130.5, 0.2743 },
+    {131.0, 0.2709 },
+    {131.5, 0.2675 },
+    {132.0, 0.2642 },
+    {132.5, 0.2609 },
+    {133.0, 0.2577 },
+    {133.5, 0.2545 },
+    {134.0, 0.2514 },
+    {134.5, 0.2483 },
+    {135.0, 0.2453 },
+    {135.5, 0.2423 },
+    {136.0, 0.2393 },
+    {136.5, 0.2364 },
+    {137.0, 0.2336 },
+    {137.5, 0.2307 },
+    {138.0, 0.2279 },
+    {138.5, 0.2252 },
+    {139.0, 0.2225 },
+    {139.5, 0.2198 },
+    {140.0, 0.2172 },
+    {141.0, 0.2121 },
+    {142.0, 0.2071 },
+    {143.0, 0.2023 },
+    {144.0, 0.1976 },
+    {145.0, 0.1930 },
+    {146.0, 0.1884 },
+    {147.0, 0.1840 },
+    {148.0, 0.1796 },
+    {149.0, 0.1754 },
+    {150.0, 0.1713 },
+    {151.0, 0.1674 },
+    {152.0, 0.1636 },
+    {153.0, 0.1599 },
+    {154.0, 0.1562 },
+    {155.0, 0.1525 },
+    {156.0, 0.1484 },
+    {157.0, 0.1444 },
+    {158.0, 0.1405 },
+    {159.0, 0.1368 },
+    {160.0, 0.1334 },
+    {162.0, 0.1289 },
+    {164.0, 0.1252 },
+    {166.0, 0.1208 },
+    {168.0, 0.1157 },
+    {170.0, 0.1106 },
+    {172.0, 0.1060 },
+    {174.0, 0.1016 },
+    {176.0, 0.09732 },
+    {178.0, 0.09310 },
+    {180.0, 0.08917 },
+    {182.0, 0.08589 },
+    {184.0, 0.08286 },
+    {186.0, 0.07981 },
+    {188.0, 0.07668 },
+    {190.0, 0.07366 },
+    {192.0, 0.07089 },
+    {194.0, 0.06826 },
+    {196.0, 0.06573 },
+    {198.0, 0.06330 },
+    {200.0, 0.06096 },
+    {202.0, 0.05872 },
+    {204.0, 0.05658 },
+    {206.0, 0.05453 },
+    {208.0, 0.05256 },
+    {210.0, 0.05068 },
+    {212.0, 0.04887 },
+    {214.0, 0.04713 },
+    {216.0, 0.04547 },
+    {218.0, 0.04388 },
+    {220.0, 0.04235 },
+    {222.0, 0.04089 },
+    {224.0, 0.03949 },
+    {226.0, 0.03814 },
+    {228.0, 0.03684 },
+    {230.0, 0.03560 },
+    {232.0, 0.03439 },
+    {234.0, 0.03323 },
+    {236.0, 0.03210 },
+    {238.0, 0.03103 },
+    {240.0, 0.02999 },
+    {242.0, 0.02900 },
+    {244.0, 0.02805 },
+    {246.0, 0.02713 },
+    {248.0, 0.02625 },
+    {250.0, 0.02540 },
+    {252.0, 0.02458 },
+    {254.0, 0.02379 },
+    {256.0, 0.02302 },
+    {258.0, 0.02229 },
+    {260.0, 0.02158 },
+    {262.0, 0.02089 },
+    {264.0, 0.02023 },
+    {266.0, 0.01960 },
+    {268.0, 0.01898 },
+    {270.0, 0.01839 },
+    {272.0, 0.01782 },
+    {274.0, 0.01727 },
+    {276.0, 0.01675 },
+    {278.0, 0.01624 },
+    {280.0, 0.01575 },
+    {282.0, 0.01528 },
+    {284.0, 0.01482 },
+    {286.0, 0.01438 },
+    {288.0, 0.01396 },
+    {290.0, 0.01355 },
+    {295.0, 0.01257 },
+    {300.0, 0.01169 }
+  };
+  static const Table table = { points, sizeof(points)/sizeof(points[0]) };
+  return table;
 }
 
-inline void
+inline const CrossSection::Table&
 CrossSection::ttH()
 {
-  xsec_[ 90.0] = 0.2162; 	
-  xsec_[ 95.0] = 0.1880; 	
-  xsec_[100.0] = 0.1638; 	
-  xsec_[105.0] = 0.1433; 	
-  xsec_[110.0] = 0.1257; 	
-  xsec_[110.5] = 0.1241; 	
-  xsec_[111.0] = 0.1225; 	
-  xsec_[111.5] = 0.1209; 	
-  xsec_[112.0] = 0.1194; 	
-  xsec_[112.5] = 0.1179; 	
-  xsec_[113.0] = 0.1164; 	
-  xsec_[113.5] = 0.1149; 	
-  xsec_[114.0] = 0.1134; 	
-  xsec_[114.5] = 0.1120; 	
-  xsec_[115.0] = 0.1106; 	
-  xsec_[115.5] = 0.1092; 	
-  xsec_[116.0] = 0.1078; 	
-  xsec_[116.5] = 0.1065; 	
-  xsec_[117.0] = 0.1051; 	
-  xsec_[117.5] = 0.1038; 	
-  xsec_[118.0] = 0.1025; 	
-  xsec_[118.5] = 0.1013; 	
-  xsec_[119.0] = 0.1000; 	
-  xsec_[119.5] = 0.09878;
-  xsec_[120.0] = 0.09756;
-  xsec_[120.5] = 0.09636;
-  xsec_[121.0] = 0.09518;
-  xsec_[121.5] = 0.09402;
-  xsec_[122.0] = 0.09287;
-  xsec_[122.5] = 0.09174;
-  xsec_[123.0] = 0.09063;
-  xsec_[123.5] = 0.08954;
-  xsec_[124.0] = 0.08846;
-  xsec_[124.5] = 0.08739;
-  xsec_[125.0] = 0.08634;
-  xsec_[125.5] = 0.08530;
-  xsec_[126.0] = 0.08428;
-  xsec_[126.5] = 0.08327;
-  xsec_[127.0] = 0.08227;
-  xsec_[127.5] = 0.08129;
-  xsec_[128.0] = 0.08032;
-  xsec_[128.5] = 0.07937;
-  xsec_[129.0] = 0.07842;
-  xsec_[129.5] = 0.07750;
-  xsec_[130.0] = 0.07658;
-  xsec_[130.5] = 0.07568;
-  xsec_[131.0] = 0.07479;
-  xsec_[131.5] = 0.07391;
-  xsec_[132.0] = 0.07304;
-  xsec_[132.5] = 0.07219;
-  xsec_[133.0] = 0.07135;
-  xsec_[133.5] = 0.07052;
-  xsec_[134.0] = 0.06970;
-  xsec_[134.5] = 0.06890;
-  xsec_[135.0] = 0.06810;
-  xsec_[135.5] = 0.06731;
-  xsec_[136.0] = 0.06654;
-  xsec_[136.5] = 0.06577;
-  xsec_[137.0] = 0.06502;
-  xsec_[137.5] = 0.06428;
-  xsec_[138.0] = 0.06355;
-  xsec_[138.5] = 0.06282;
-  xsec_[139.0] = 0.06211;
-  xsec_[139.5] = 0.06141;
-  xsec_[140.0] = 0.06072;
-  xsec_[141.0] = 0.05937;
-  xsec_[142.0] = 0.05807;
-  xsec_[143.0] = 0.05680;
-  xsec_[144.0] = 0.05556;
-  xsec_[145.0] = 0.05435;
-  xsec_[146.0] = 0.05316;
-  xsec_[147.0] = 0.05200;
-  xsec_[148.0] = 0.05087;
-  xsec_[149.0] = 0.04976;
-  xsec_[150.0] = 0.04869;
-  xsec_[151.0] = 0.04765;
-  xsec_[152.0] = 0.04663;
-  xsec_[153.0] = 0.04564;
-  xsec_[154.0] = 0.04468;
-  xsec_[155.0] = 0.04374;
-  xsec_[156.0] = 0.04283;
-  xsec_[157.0] = 0.04194;
-  xsec_[158.0] = 0.04108;
-  xsec_[159.0] = 0.04024;
-  xsec_[160.0] = 0.03942;
-  xsec_[162.0] = 0.03783;
-  xsec_[164.0] = 0.03632;
-  xsec_[166.0] = 0.03488;
-  xsec_[168.0] = 0.03350;
-  xsec_[170.0] = 0.03219;
-  xsec_[172.0] = 0.03094;
-  xsec_[174.0] = 0.02975;
-  xsec_[176.0] = 0.02862;
-  xsec_[178.0] = 0.02755;
-  xsec_[180.0] = 0.02652;
-  xsec_[182.0] = 0.02553;
-  xsec_[184.0] = 0.02459;
-  xsec_[186.0] = 0.02370;
-  xsec_[188.0] = 0.02286;
-  xsec_[190.0] = 0.02206;
-  xsec_[192.0] = 0.02128;
-  xsec_[194.0] = 0.02052;
-  xsec_[196.0] = 0.01981;
-  xsec_[198.0] = 0.01913;
-  xsec_[200.0] = 0.01849;
-  xsec_[202.0] = 0.01787;
-  xsec_[204.0] = 0.01727;
-  xsec_[206.0] = 0.01670;
-  xsec_[208.0] = 0.01615;
-  xsec_[210.0] = 0.01562;
-  xsec_[212.0] = 0.01512;
-  xsec_[214.0] = 0.01463;
-  xsec_[216.0] = 0.01417;
-  xsec_[218.0] = 0.01373;
-  xsec_[220.0] = 0.01330;
-  xsec_[222.0] = 0.01289;
-  xsec_[224.0] = 0.01251;
-  xsec_[226.0] = 0.01213;
-  xsec_[228.0] = 0.01178;
-  xsec_[230.0] = 0.01143;
-  xsec_[232.0] = 0.01110;
-  xsec_[234.0] = 0.01077;
-  xsec_[236.0] = 0.01046;
-  xsec_[238.0] = 0.01016;
-  xsec_[240.0] = 0.009873;
-  xsec_[242.0] = 0.009597;
-  xsec_[244.0] = 0.009331;
-  xsec_[246.0] = 0.009076;
-  xsec_[248.0] = 0.008830;
-  xsec_[250.0] = 0.008593;
-  xsec_[252.0] = 0.008363;
-  xsec_[254.0] = 0.008142;
-  xsec_[256.0] = 0.007928;
-  xsec_[258.0] = 0.007722;
-  xsec_[260.0] = 0.007524;
-  xsec_[262.0] = 0.007333;
-  xsec_[264.0] = 0.007149;
-  xsec_[266.0] = 0.006972;
-  xsec_[268.0] = 0.006801;
-  xsec_[270.0] = 0.006636;
-  xsec_[272.0] = 0.006476;
-  xsec_[274.0] = 0.006322;
-  xsec_[276.0] = 0.006173;
-  xsec_[278.0] = 0.006028;
-  xsec_[280.0] = 0.005889;
-  xsec_[282.0] = 0.005754;
-  xsec_[284.0] = 0.005623;
-  xsec_[286.0] = 0.005497;
-  xsec_[288.0] = 0.005374;
-  xsec_[290.0] = 0.005256;
-  xsec_[295.0] = 0.004975;
-  xsec_[300.0] = 0.004719;
+  static const float points[][2] = {
+    { 90.0, 0.2162 },
+    { 95.0, 0.1880 },
+    {100.0, 0.1638 },
+    {105.0, 0.1433 },
+    {110.0, 0.1257 },
+    {110.5, 0.1241 },
+    {111.0, 0.1225 },
+    {111.5, 0.1209 },
+    {112.0, 0.1194 },
+    {112.5, 0.1179 },
+    {113.0, 0.1164 },
+    {113.5, 0.1149 },
+    {114.0, 0.1134 },
+    {114.5, 0.1120 },
+    {115.0, 0.1106 },
+    {115.5, 0.1092 },
+    {116.0, 0.1078 },
+    {116.5, 0.1065 },
+    {117.0, 0.1051 },
+    {117.5, 0.1038 },
+    {118.0, 0.1025 },
+    {118.5, 0.1013 },
+    {119.0, 0.1000 },
+    {119.5, 0.09878 },
+    {120.0, 0.09756 },
+    {120.5, 0.09636 },
+    {121.0, 0.09518 },
+    {121.5, 0.09402 },
+    {122.0, 0.09287 },
+    {122.5, 0.09174 },
+    {123.0, 0.09063 },
+    {123.5, 0.08954 },
+    {124.0, 0.08846 },
+    {124.5, 0.08739 },
+    {125.0, 0.08634 },
+    {125.5, 0.08530 },
+    {126.0, 0.08428 },
+    {126.5, 0.08327 },
+    {127.0, 0.08227 },
+    {127.5, 0.08129 },
+    {128.0, 0.08032 },
+    {128.5, 0.07937 },
+    {129.0, 0.07842 },
+    {129.5, 0.07750 },
+    {130.0, 0.07658 },
+    {130.5, 0.07568 },
+    {131.0, 0.07479 },
+    {131.5, 0.07391 },
+    {132.0, 0.07304 },
+    {132.5, 0.07219 },
+    {133.0, 0.07135 },
+    {133.5, 0.07052 },
+    {134.0, 0.06970 },
+    {134.5, 0.06890 },
+    {135.0, 0.06810 },
+    {135.5, 0.06731 },
+    {136.0, 0.06654 },
+    {136.5, 0.06577 },
+    {137.0, 0.06502 },
+    {137.5, 0.06428 },
+    {138.0, 0.06355 },
+    {138.5, 0.06282 },
+    {139.0, 0.06211 },
+    {139.5, 0.06141 },
+    {140.0, 0.06072 },
+    {141.0, 0.05937 },
+    {142.0, 0.05807 },
+    {143.0, 0.05680 },
+    {144.0, 0.05556 },
+    {145.0, 0.05435 },
+    {146.0, 0.05316 },
+    {147.0, 0.05200 },
+    {148.0, 0.05087 },
+    {149.0, 0.04976 },
+    {150.0, 0.04869 },
+    {151.0, 0.04765 },
+    {152.0, 0.04663 },
+    {153.0, 0.04564 },
+    {154.0, 0.04468 },
+    {155.0, 0.04374 },
+    {156.0, 0.04283 },
+    {157.0, 0.04194 },
+    {158.0, 0.04108 },
+    {159.0, 0.04024 },
+    {160.0, 0.03942 },
+    {162.0, 0.03783 },
+    {164.0, 0.03632 },
+    {166.0, 0.03488 },
+    {168.0, 0.03350 },
+    {170.0, 0.03219 },
+    {172.0, 0.03094 },
+    {174.0, 0.02975 },
+    {176.0, 0.02862 },
+    {178.0, 0.02755 },
+    {180.0, 0.02652 },
+    {182.0, 0.02553 },
+    {184.0, 0.02459 },
+    {186.0, 0.02370 },
+    {188.0, 0.02286 },
+    {190.0, 0.02206 },
+    {192.0, 0.02128 },
+    {194.0, 0.02052 },
+    {196.0, 0.01981 },
+    {198.0, 0.01913 },
+    {200.0, 0.01849 },
+    {202.0, 0.01787 },
+    {204.0, 0.01727 },
+    {206.0, 0.01670 },
+    {208.0, 0.01615 },
+    {210.0, 0.01562 },
+    {212.0, 0.01512 },
+    {214.0, 0.01463 },
+    {216.0, 0.01417 },
+    {218.0, 0.01373 },
+    {220.0, 0.01330 },
+    {222.0, 0.01289 },
+    {224.0, 0.01251 },
+    {226.0, 0.01213 },
+    {228.0, 0.01178 },
+    {230.0, 0.01143 },
+    {232.0, 0.01110 },
+    {234.0, 0.01077 },
+    {236.0, 0.01046 },
+    {238.0, 0.01016 },
+    {240.0, 0.009873 },
+    {242.0, 0.009597 },
+    {244.0, 0.009331 },
+    {246.0, 0.009076 },
+    {248.0, 0.008830 },
+    {250.0, 0.008593 },
+    {252.0, 0.008363 },
+    {254.0, 0.008142 },
+    {256.0, 0.007928 },
+    {258.0, 0.007722 },
+    {260.0, 0.007524 },
+    {262.0, 0.007333 },
+    {264.0, 0.007149 },
+    {266.0, 0.006972 },
+    {268.0, 0.006801 },
+    {270.0, 0.006636 },
+    {272.0, 0.006476 },
+    {274.0, 0.006322 },
+    {276.0, 0.006173 },
+    {278.0, 0.006028 },
+    {280.0, 0.005889 },
+    {282.0, 0.005754 },
+    {284.0, 0.005623 },
+    {286.0, 0.005497 },
+    {288.0, 0.005374 },
+    {290.0, 0.005256 },
+    {295.0, 0.004975 },
+    {300.0, 0.004719 }
+  };
+  static const Table table = { points, sizeof(points)/sizeof(points[0]) };
+  return table;
 }
 
-inline void
+inline const CrossSection::Table&
 CrossSection::BR()
 {
-  xsec_[  90.0] = 8.41E-02;
-  xsec_[  95.0] = 8.41E-02;
-  xsec_[ 100.0] = 8.36E-02;
-  xsec_[ 105.0] = 8.25E-02;
-  xsec_[ 110.0] = 8.02E-02;
-  xsec_[ 110.5] = 7.99E-02;
-  xsec_[ 111.0] = 7.96E-02;
-  xsec_[ 111.5] = 7.93E-02;
-  xsec_[ 112.0] = 7.89E-02;
-  xsec_[ 112.5] = 7.86E-02;
-  xsec_[ 113.0] = 7.82E-02;
-  xsec_[ 113.5] = 7.78E-02;
-  xsec_[ 114.0] = 7.74E-02;
-  xsec_[ 114.5] = 7.69E-02;
-  xsec_[ 115.0] = 7.65E-02;
-  xsec_[ 115.5] = 7.60E-02;
-  xsec_[ 116.0] = 7.55E-02;
-  xsec_[ 116.5] = 7.50E-02;
-  xsec_[ 117.0] = 7.45E-02;
-  xsec_[ 117.5] = 7.40E-02;
-  xsec_[ 118.0] = 7.34E-02;
-  xsec_[ 118.5] = 7.28E-02;
-  xsec_[ 119.0] = 7.22E-02;
-  xsec_[ 119.5] = 7.16E-02;
-  xsec_[ 120.0] = 7.10E-02;
-  xsec_[ 120.5] = 7.03E-02;
-  xsec_[ 121.0] = 6.97E-02;
-  xsec_[ 121.5] = 6.90E-02;
-  xsec_[ 122.0] = 6.83E-02;
-  xsec_[ 122.5] = 6.75E-02;
-  xsec_[ 123.0] = 6.68E-02;
-  xsec_[ 123.5] = 6.60E-02;
-  xsec_[ 124.0] = 6.53E-02;
-  xsec_[ 124.5] = 6.45E-02;
-  xsec_[ 125.0] = 6.37E-02;
-  xsec_[ 125.5] = 6.28E-02;
-  xsec_[ 126.0] = 6.20E-02;
-  xsec_[ 126.5] = 6.12E-02;
-  xsec_[ 127.0] = 6.03E-02;
-  xsec_[ 127.5] = 5.94E-02;
-  xsec_[ 128.0] = 5.85E-02;
-  xsec_[ 128.5] = 5.76E-02;
-  xsec_[ 129.0] = 5.67E-02;
-  xsec_[ 129.5] = 5.58E-02;
-  xsec_[ 130.0] = 5.48E-02;
-  xsec_[ 130.5] = 5.39E-02;
-  xsec_[ 131.0] = 5.29E-02;
-  xsec_[ 131.5] = 5.20E-02;
-  xsec_[ 132.0] = 5.10E-02;
-  xsec_[ 132.5] = 5.01E-02;
-  xsec_[ 133.0] = 4.91E-02;
-  xsec_[ 133.5] = 4.81E-02;
-  xsec_[ 134.0] = 4.71E-02;
-  xsec_[ 134.5] = 4.61E-02;
-  xsec_[ 135.0] = 4.52E-02;
-  xsec_[ 135.5] = 4.42E-02;
-  xsec_[ 136.0] = 4.32E-02;
-  xsec_[ 136.5] = 4.22E-02;
-  xsec_[ 137.0] = 4.12E-02;
-  xsec_[ 137.5] = 4.02E-02;
-  xsec_[ 138.0] = 3.93E-02;
-  xsec_[ 138.5] = 3.83E-02;
-  xsec_[ 139.0] = 3.73E-02;
-  xsec_[ 139.5] = 3.63E-02;
-  xsec_[ 140.0] = 3.54E-02;
-  xsec_[ 141.0] = 3.35E-02;
-  xsec_[ 142.0] = 3.16E-02;
-  xsec_[ 143.0] = 2.97E-02;
-  xsec_[ 144.0] = 2.79E-02;
-  xsec_[ 145.0] = 2.61E-02;
-  xsec_[ 146.0] = 2.44E-02;
-  xsec_[ 147.0] = 2.27E-02;
-  xsec_[ 148.0] = 2.11E-02;
-  xsec_[ 149.0] = 1.94E-02;
-  xsec_[ 150.0] = 1.78E-02;
-  xsec_[ 151.0] = 1.63E-02;
-  xsec_[ 152.0] = 1.48E-02;
-  xsec_[ 153.0] = 1.33E-02;
-  xsec_[ 154.0] = 1.19E-02;
-  xsec_[ 155.0] = 1.05E-02;
-  xsec_[ 156.0] = 9.16E-03;
-  xsec_[ 157.0] = 7.81E-03;
-  xsec_[ 158.0] = 6.48E-03;
-  xsec_[ 159.0] = 5.18E-03;
-  xsec_[ 160.0] = 3.96E-03;
-  xsec_[ 162.0] = 2.27E-03;
-  xsec_[ 164.0] = 1.57E-03;
-  xsec_[ 166.0] = 1.24E-03;
-  xsec_[ 168.0] = 1.05E-03;
-  xsec_[ 170.0] = 9.19E-04;
-  xsec_[ 172.0] = 8.25E-04;
-  xsec_[ 174.0] = 7.51E-04;
-  xsec_[ 176.0] = 6.90E-04;
-  xsec_[ 178.0] = 6.36E-04;
-  xsec_[ 180.0] = 5.87E-04;
-  xsec_[ 182.0] = 5.34E-04;
-  xsec_[ 184.0] = 4.81E-04;
-  xsec_[ 186.0] = 4.37E-04;
-  xsec_[ 188.0] = 4.03E-04;
-  xsec_[ 190.0] = 3.76E-04;
-  xsec_[ 192.0] = 3.53E-04;
-  xsec_[ 194.0] = 3.33E-04;
-  xsec_[ 196.0] = 3.16E-04;
-  xsec_[ 198.0] = 3.01E-04;
-  xsec_[ 200.0] = 2.87E-04;
-  xsec_[ 202.0] = 2.75E-04;
-  xsec_[ 204.0] = 2.63E-04;
-  xsec_[ 206.0] = 2.53E-04;
-  xsec_[ 208.0] = 2.43E-04;
-  xsec_[ 210.0] = 2.34E-04;
-  xsec_[ 212.0] = 2.25E-04;
-  xsec_[ 214.0] = 2.18E-04;
-  xsec_[ 216.0] = 2.10E-04;
-  xsec_[ 218.0] = 2.03E-04;
-  xsec_[ 220.0] = 1.96E-04;
-  xsec_[ 222.0] = 1.90E-04;
-  xsec_[ 224.0] = 1.84E-04;
-  xsec_[ 226.0] = 1.78E-04;
-  xsec_[ 228.0] = 1.73E-04;
-  xsec_[ 230.0] = 1.68E-04;
-  xsec_[ 232.0] = 1.63E-04;
-  xsec_[ 234.0] = 1.58E-04;
-  xsec_[ 236.0] = 1.54E-04;
-  xsec_[ 238.0] = 1.50E-04;
-  xsec_[ 240.0] = 1.45E-04;
-  xsec_[ 242.0] = 1.42E-04;
-  xsec_[ 244.0] = 1.38E-04;
-  xsec_[ 246.0] = 1.34E-04;
-  xsec_[ 248.0] = 1.31E-04;
-  xsec_[ 250.0] = 1.27E-04;
-  xsec_[ 252.0] = 1.24E-04;
-  xsec_[ 254.0] = 1.21E-04;
-  xsec_[ 256.0] = 1.18E-04;
-  xsec_[ 258.0] = 1.15E-04;
-  xsec_[ 260.0] = 1.12E-04;
-  xsec_[ 262.0] = 1.10E-04;
-  xsec_[ 264.0] = 1.07E-04;
-  xsec_[ 266.0] = 1.05E-04;
-  xsec_[ 268.0] = 1.02E-04;
-  xsec_[ 270.0] = 1.00E-04;
-  xsec_[ 272.0] = 9.79E-05;
-  xsec_[ 274.0] = 9.58E-05;
-  xsec_[ 276.0] = 9.37E-05;
-  xsec_[ 278.0] = 9.17E-05;
-  xsec_[ 280.0] = 8.98E-05;
-  xsec_[ 282.0] = 8.79E-05;
-  xsec_[ 284.0] = 8.61E-05;
-  xsec_[ 286.0] = 8.43E-05;
-  xsec_[ 288.0] = 8.26E-05;
-  xsec_[ 290.0] = 8.09E-05;
-  xsec_[ 295.0] = 7.70E-05;
-  xsec_[ 300.0] = 7.34E-05;
-  xsec_[ 305.0] = 7.00E-05;
-  xsec_[ 310.0] = 6.68E-05;
-  xsec_[ 315.0] = 6.39E-05;
-  xsec_[ 320.0] = 6.12E-05;
-  xsec_[ 325.0] = 5.86E-05;
-  xsec_[ 330.0] = 5.63E-05;
-  xsec_[ 335.0] = 5.41E-05;
-  xsec_[ 340.0] = 5.20E-05;
-  xsec_[ 345.0] = 5.02E-05;
-  xsec_[ 350.0] = 4.76E-05;
-  xsec_[ 360.0] = 4.23E-05;
-  xsec_[ 370.0] = 3.78E-05;
-  xsec_[ 380.0] = 3.40E-05;
-  xsec_[ 390.0] = 3.09E-05;
-  xsec_[ 400.0] = 2.84E-05;
-  xsec_[ 420.0] = 2.43E-05;
-  xsec_[ 440.0] = 2.12E-05;
-  xsec_[ 460.0] = 1.88E-05;
-  xsec_[ 480.0] = 1.69E-05;
-  xsec_[ 500.0] = 1.53E-05;
-  xsec_[ 520.0] = 1.40E-05;
-  xsec_[ 540.0] = 1.28E-05;
-  xsec_[ 560.0] = 1.18E-05;
-  xsec_[ 580.0] = 1.10E-05;
-  xsec_[ 600.0] = 1.02E-05;
-  xsec_[ 610.0] = 9.86E-06;
-  xsec_[ 620.0] = 9.53E-06;
-  xsec_[ 630.0] = 9.21E-06;
-  xsec_[ 640.0] = 8.91E-06;
-  xsec_[ 650.0] = 8.63E-06;
-  xsec_[ 660.0] = 8.35E-06;
-  xsec_[ 670.0] = 8.09E-06;
-  xsec_[ 680.0] = 7.84E-06;
-  xsec_[ 690.0] = 7.60E-06;
-  xsec_[ 700.0] = 7.37E-06;
-  xsec_[ 710.0] = 7.15E-06;
-  xsec_[ 720.0] = 6.94E-06;
-  xsec_[ 730.0] = 6.74E-06;
-  xsec_[ 740.0] = 6.55E-06;
-  xsec_[ 750.0] = 6.36E-06;
-  xsec_[ 760.0] = 6.18E-06;
-  xsec_[ 770.0] = 6.00E-06;
-  xsec_[ 780.0] = 5.83E-06;
-  xsec_[ 790.0] = 5.67E-06;
-  xsec_[ 800.0] = 5.52E-06;
-  xsec_[ 810.0] = 5.36E-06;
-  xsec_[ 820.0] = 5.22E-06;
-  xsec_[ 830.0] = 5.07E-06;
-  xsec_[ 840.0] = 4.94E-06;
-  xsec_[ 850.0] = 4.80E-06;
-  xsec_[ 860.0] = 4.67E-06;
-  xsec_[ 870.0] = 4.55E-06;
-  xsec_[ 880.0] = 4.42E-06;
-  xsec_[ 890.0] = 4.31E-06;
-  xsec_[ 900.0] = 4.19E-06;
-  xsec_[ 910.0] = 4.08E-06;
-  xsec_[ 920.0] = 3.97E-06;
-  xsec_[ 930.0] = 3.86E-06;
-  xsec_[ 940.0] = 3.76E-06;
-  xsec_[ 950.0] = 3.66E-06;
-  xsec_[ 960.0] = 3.56E-06;
-  xsec_[ 970.0] = 3.47E-06;
-  xsec_[ 980.0] = 3.38E-06;
-  xsec_[ 990.0] = 3.29E-06;
-  xsec_[1000.0] = 3.20E-06;
+  static const float points[][2] = {
+    {  90.0, 8.41E-02 },
+    {  95.0, 8.41E-02 },
+    { 100.0, 8.36E-02 },
+    { 105.0, 8.25E-02 },
+    { 110.0, 8.02E-02 },
+    { 110.5, 7.99E-02 },
+    { 111.0, 7.96E-02 },
+    { 111.5, 7.93E-02 },
+    { 112.0, 7.89E-02 },
+    { 112.5, 7.86E-02 },
+    { 113.0, 7.82E-02 },
+    { 113.5, 7.78E-02 },
+    { 114.0, 7.74E-02 },
+    { 114.5, 7.69E-02 },
+    { 115.0, 7.65E-02 },
+    { 115.5, 7.60E-02 },
+    { 116.0, 7.55E-02 },
+    { 116.5, 7.50E-02 },
+    { 117.0, 7.45E-02 },
+    { 117.5, 7.40E-02 },
+    { 118.0, 7.34E-02 },
+    { 118.5, 7.28E-02 },
+    { 119.0, 7.22E-02 },
+    { 119.5, 7.16E-02 },
+    { 120.0, 7.10E-02 },
+    { 120.5, 7.03E-02 },
+    { 121.0, 6.97E-02 },
+    { 121.5, 6.90E-02 },
+    { 122.0, 6.83E-02 },
+    { 122.5, 6.75E-02 },
+    { 123.0, 6.68E-02 },
+    { 123.5, 6.60E-02 },
+    { 124.0, 6.53E-02 },
+    { 124.5, 6.45E-02 },
+    { 125.0, 6.37E-02 },
+    { 125.5, 6.28E-02 },
+    { 126.0, 6.20E-02 },
+    { 126.5, 6.12E-02 },
+    { 127.0, 6.03E-02 },
+    { 127.5, 5.94E-02 },
+    { 128.0, 5.85E-02 },
+    { 128.5, 5.76E-02 },
+    { 129.0, 5.67E-02 },
+    { 129.5, 5.58E-02 },
+    { 130.0, 5.48E-02 },
+    { 130.5, 5.39E-02 },
+    { 131.0, 5.29E-02 },
+    { 131.5, 5.20E-02 },
+    { 132.0, 5.10E-02 },
+    { 132.5, 5.01E-02 },
+    { 133.0, 4.91E-02 },
+    { 133.5, 4.81E-02 },
+    { 134.0, 4.71E-02 },
+    { 134.5, 4.61E-02 },
+    { 135.0, 4.52E-02 },
+    { 135.5, 4.42E-02 },
+    { 136.0, 4.32E-02 },
+    { 136.5, 4.22E-02 },
+    { 137.0, 4.12E-02 },
+    { 137.5, 4.02E-02 },
+    { 138.0, 3.93E-02 },
+    { 138.5, 3.83E-02 },
+    { 139.0, 3.73E-02 },
+    { 139.5, 3.63E-02 },
+    { 140.0, 3.54E-02 },
+    { 141.0, 3.35E-02 },
+    { 142.0, 3.16E-02 },
+    { 143.0, 2.97E-02 },
+    { 144.0, 2.79E-02 },
+    { 145.0, 2.61E-02 },
+    { 146.0, 2.44E-02 },
+    { 147.0, 2.27E-02 },
+    { 148.0, 2.11E-02 },
+    { 149.0, 1.94E-02 },
+    { 150.0, 1.78E-02 },
+    { 151.0, 1.63E-02 },
+    { 152.0, 1.48E-02 },
+    { 153.0, 1.33E-02 },
+    { 154.0, 1.19E-02 },
+    { 155.0, 1.05E-02 },
+    { 156.0, 9.16E-03 },
+    { 157.0, 7.81E-03 },
+    { 158.0, 6.48E-03 },
+    { 159.0, 5.18E-03 },
+    { 160.0, 3.96E-03 },
+    { 162.0, 2.27E-03 },
+    { 164.0, 1.57E-03 },
+    { 166.0, 1.24E-03 },
+    { 168.0, 1.05E-03 },
+    { 170.0, 9.19E-04 },
+    { 172.0, 8.25E-04 },
+    { 174.0, 7.51E-04 },
+    { 176.0, 6.90E-04 },
+    { 178.0, 6.36E-04 },
+    { 180.0, 5.87E-04 },
+    { 182.0, 5.34E-04 },
+    { 184.0, 4.81E-04 },
+    { 186.0, 4.37E-04 },
+    { 188.0, 4.03E-04 },
+    { 190.0, 3.76E-04 },
+    { 192.0, 3.53E-04 },
+    { 194.0, 3.33E-04 },
+    { 196.0, 3.16E-04 },
+    { 198.0, 3.01E-04 },
+    { 200.0, 2.87E-04 },
+    { 202.0, 2.75E-04 },
+    { 204.0, 2.63E-04 },
+    { 206.0, 2.53E-04 },
+    { 208.0, 2.43E-04 },
+    { 210.0, 2.34E-04 },
+    { 212.0, 2.25E-04 },
+    { 214.0, 2.18E-04 },
+    { 216.0, 2.10E-04 },
+    { 218.0, 2.03E-04 },
+    { 220.0, 1.96E-04 },
+    { 222.0, 1.90E-04 },
+    { 224.0, 1.84E-04 },
+    { 226.0, 1.78E-04 },
+    { 228.0, 1.73E-04 },
+    { 230.0, 1.68E-04 },
+    { 232.0, 1.63E-04 },
+    { 234.0, 1.58E-04 },
+    { 236.0, 1.54E-04 },
+    { 238.0, 1.50E-04 },
+    { 240.0, 1.45E-04 },
+    { 242.0, 1.42E-04 },
+    { 244.0, 1.38E-04 },
+    { 246.0, 1.34E-04 },
+    { 248.0, 1.31E-04 },
+    { 250.0, 1.27E-04 },
+    { 252.0, 1.24E-04 },
+    { 254.0, 1.21E-04 },
+    { 256.0, 1.18E-04 },
+    { 258.0, 1.15E-04 },
+    { 260.0, 1.12E-04 },
+    { 262.0, 1.10E-04 },
+    { 264.0, 1.07E-04 },
+    { 266.0, 1.05E-04 },
+    { 268.0, 1.02E-04 },
+    { 270.0, 1.00E-04 },
+    { 272.0, 9.79E-05 },
+    { 274.0, 9.58E-05 },
+    { 276.0, 9.37E-05 },
+    { 278.0, 9.17E-05 },
+    { 280.0, 8.98E-05 },
+    { 282.0, 8.79E-05 },
+    { 284.0, 8.61E-05 },
+    { 286.0, 8.43E-05 },
+    { 288.0, 8.26E-05 },
+    { 290.0, 8.09E-05 },
+    { 295.0, 7.70E-05 },
+    { 300.0, 7.34E-05 },
+    { 305.0, 7.00E-05 },
+    { 310.0, 6.68E-05 },
+    { 315.0, 6.39E-05 },
+    { 320.0, 6.12E-05 },
+    { 325.0, 5.86E-05 },
+    { 330.0, 5.63E-05 },
+    { 335.0, 5.41E-05 },
+    { 340.0, 5.20E-05 },
+    { 345.0, 5.02E-05 },
+    { 350.0, 4.76E-05 },
+    { 360.0, 4.23E-05 },
+    { 370.0, 3.78E-05 },
+    { 380.0, 3.40E-05 },
+    { 390.0, 3.09E-05 },
+    { 400.0, 2.84E-05 },
+    { 420.0, 2.43E-05 },
+    { 440.0, 2.12E-05 },
+    { 460.0, 1.88E-05 },
+    { 480.0, 1.69E-05 },
+    { 500.0, 1.53E-05 },
+    { 520.0, 1.40E-05 },
+    { 540.0, 1.28E-05 },
+    { 560.0, 1.18E-05 },
+    { 580.0, 1.10E-05 },
+    { 600.0, 1.02E-05 },
+    { 610.0, 9.86E-06 },
+    { 620.0, 9.53E-06 },
+    { 630.0, 9.21E-06 },
+    { 640.0, 8.91E-06 },
+    { 650.0, 8.63E-06 },
+    { 660.0, 8.35E-06 },
+    { 670.0, 8.09E-06 },
+    { 680.0, 7.84E-06 },
+    { 690.0, 7.60E-06 },
+    { 700.0, 7.37E-06 },
+    { 710.0, 7.15E-06 },
+    { 720.0, 6.94E-06 },
+    { 730.0, 6.74E-06 },
+    { 740.0, 6.55E-06 },
+    { 750.0, 6.36E-06 },
+    { 760.0, 6.18E-06 },
+    { 770.0, 6.00E-06 },
+    { 780.0, 5.83E-06 },
+    { 790.0, 5.67E-06 },
+    { 800.0, 5.52E-06 },
+    { 810.0, 5.36E-06 },
+    { 820.0, 5.22E-06 },
+    { 830.0, 5.07E-06 },
+    { 840.0, 4.94E-06 },
+    { 850.0, 4.80E-06 },
+    { 860.0, 4.67E-06 },
+    { 870.0, 4.55E-06 },
+    { 880.0, 4.42E-06 },
+    { 890.0, 4.31E-06 },
+    { 900.0, 4.19E-06 },
+    { 910.0, 4.08E-06 },
+    { 920.0, 3.97E-06 },
+    { 930.0, 3.86E-06 },
+    { 940.0, 3.76E-06 },
+    { 950.0, 3.66E-06 },
+    { 960.0, 3.56E-06 },
+    { 970.0, 3.47E-06 },
+    { 980.0, 3.38E-06 },
+    { 990.0, 3.29E-06 },
+    {1000.0, 3.20E-06 }
+  };
+  static const Table table = { points, sizeof(points)/sizeof(points[0]) };
+  return table;
 }
 #endif
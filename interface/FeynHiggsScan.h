@@ -3,6 +3,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 #include <utility>
 #include <iostream>
 
@@ -14,12 +15,48 @@
 #include "TString.h"
 #include "TCanvas.h"
 
+#include "HiggsAnalysis/HiggsToTauTau/interface/FlatGrid.h"
+
 /**
    \class   FeynHiggsScan FeynHiggsScan.h "HiggsAnalysis/HiggsToTauTau/interface/FeynHiggsScan.h"
 
    \brief   Class to return pre-calculated values for cross sections and branching ratios from FeynHiggs
 
-   To follow soon 
+   The values of the scan are read from a tree with one entry per point of a regular grid in mA and
+   tanb. The grid is defined by the number of points and the range in tanb and mA as passed on to
+   the constructor. On first request of a variable the tree is read once and the values are stored
+   in a contiguous array of n_mA x n_tanb floats (the index of tanb running fastest). Each grid
+   cell [mA, mA+step_mA) x [tanb, tanb+step_tanb) holds the value of the grid point at its lower
+   edge. Any further request for the same variable is served from this array, such that a lookup
+   boils down to the calculation of the array index and a single memory access. If more than one
+   entry of the tree falls into the same cell the values are summed up (as for the former projection
+   into a TH2F). Masses are only returned for exact grid points, as the value of the first entry of
+   the tree at that point. For scans with more than one entry per cell or entries outside the grid
+   the masses are therefore looked up in the tree itself.
+
+   With the function load the grids of a whole list of variables (e.g. all cross sections, branching
+   ratios and masses that are needed for a model point) are filled in a single pass over the tree,
+   with only the required branches enabled.
+
+   For the evaluation of whole planes in mA and tanb all query functions are also available for a
+   list of points, given as separate arrays of mA and tanb. Without interpolation the results are
+   identical to the ones of the single point functions. With interpolation the value is obtained from
+   a bilinear interpolation between the four grid points that surround the requested point (at the
+   upper edge of the grid the value of the last grid point is used). Points outside the grid return
+   the same default values as the single point functions. Scans with more than one entry per cell or
+   entries outside the grid are never interpolated (a warning is printed), as their cells hold sums;
+   the results are those of the single point functions then.
+
+   Instead of a ROOT file a flat file (as written by the binary export-flat-grids, see class
+   FlatGrid) can be given to the constructor. This is recognized by the extension ".flat" of the file
+   name. In this case no tree is read. The grids are taken directly from the memory mapped file, in
+   which they are stored under the name "<treeName>/<variable>". The grid points of the tree are
+   stored as the variables "mA" and "tanb". The number of points and the ranges of the grids in the
+   flat file must match the parameters passed on to the constructor. Only scans with at most one
+   entry per cell and no entries outside the grid can be written to a flat file.
+
+   If the input file cannot be opened (or does not contain the scan) an error is printed and all
+   queries return the default values; use isOpen to check for this case.
 */
 
 class FeynHiggsScan {
@@ -30,42 +67,91 @@ class FeynHiggsScan {
   /// default destructor
   ~FeynHiggsScan();
 
+  /// true if the input file could be opened and holds the scan; otherwise an error is printed on
+  /// construction and all queries return the default values (as for points outside the grid)
+  bool isOpen() const { return flat_.isOpen() || tree_!=0; };
+
+  /// fill the grids for a list of variables (branch names) in a single pass over the tree;
+  /// variables that have been read before are skipped
+  void load(const std::vector<std::string>& variables);
+  /// branch name for a given variable, model and type (e.g. "xs_sm_ggH" for type "xs", model "sm"
+  /// and variable "ggH")
+  static std::string name(const char* variable, const char* model, const char* type) { return std::string(type)+"_"+std::string(model)+"_"+std::string(variable); };
+  /// names of all variables that are available in the tree or flat file (except for mA and tanb)
+  std::vector<std::string> variables() const;
+  /// append all grids that have been filled so far (including the grid points mA and tanb) to grids;
+  /// the names of the grids are prefixed by prefix and a '/'. Returns false (and appends nothing) if
+  /// the scan has more than one entry per cell or entries outside the grid, as the masses could not
+  /// be recovered from the grids
+  bool flatten(std::vector<FlatGrid::Grid>& grids, const std::string& prefix) const;
   /// get cross section ot br from tree for given value of mA and tanb
   float get(const char* variable, const char* model, const char* type, float mA, float tanb);
   /// production cross section for mH for given mA and tanb 
   float xsec(const char* variable, const char* model, double mA, double tanb) { return get(variable, model, "xs", mA, tanb); };
   /// branching ratio for mH for given mA and tanb 
   float br(const char* variable, const char* model, double mA, double tanb) { return get(variable, model, "br", mA, tanb); };
+  /// cross section or br for a list of points in mA and tanb; results are written to values
+  void get(const char* variable, const char* model, const char* type, const std::vector<float>& mA, const std::vector<float>& tanb, std::vector<float>& values, bool interpolate=false);
+  /// production cross section for a list of points in mA and tanb
+  void xsec(const char* variable, const char* model, const std::vector<float>& mA, const std::vector<float>& tanb, std::vector<float>& values, bool interpolate=false) { get(variable, model, "xs", mA, tanb, values, interpolate); };
+  /// branching ratio for a list of points in mA and tanb
+  void br(const char* variable, const char* model, const std::vector<float>& mA, const std::vector<float>& tanb, std::vector<float>& values, bool interpolate=false) { get(variable, model, "br", mA, tanb, values, interpolate); };
   /// mass of given type for a given value of mA and tanb
   float mass(const std::string& variable, float mA, float tanb);
+  /// mass of given type for a list of points in mA and tanb; without interpolation only exact grid
+  /// points return a value different from 0 (as for the single point function)
+  void mass(const std::string& variable, const std::vector<float>& mA, const std::vector<float>& tanb, std::vector<float>& values, bool interpolate=false);
   /// mH for a given value of mA and tanb
   float mH(float mA, float tanb) { return mass(std::string("mH"), mA, tanb); };
   /// mh for a given value of mA and tanb
   float mh(float mA, float tanb) { return mass(std::string("mh"), mA, tanb); };
+  /// mH for a list of points in mA and tanb
+  void mH(const std::vector<float>& mA, const std::vector<float>& tanb, std::vector<float>& values, bool interpolate=false) { mass(std::string("mH"), mA, tanb, values, interpolate); };
+  /// mh for a list of points in mA and tanb
+  void mh(const std::vector<float>& mA, const std::vector<float>& tanb, std::vector<float>& values, bool interpolate=false) { mass(std::string("mh"), mA, tanb, values, interpolate); };
  
  private:
   /// book branches for all variables or a subset of them
   void book(const std::string& var);
-  /// set branch addresses for all variables or a subset of them 
-  void read(const std::string& var);
-  /// loop tree project the information of interest out and return int in form of a 2d histogram
-  TH2F* project(const std::string& var);
+  /// set branch addresses for a list of variables; values has to be of the same size as vars 
+  void read(const std::vector<std::string>& vars, std::vector<float>& values);
+  /// return the grid of values for variable var; the tree is only read on first request
+  const float* grid(const std::string& var);
+  /// return the grid of values for variable var from the flat file
+  const float* mapped(const std::string& var);
+  /// index of the grid cell for given value of mA and tanb; returns -1 if out of range
+  int index(float mA, float tanb) const;
+  /// value of variable var of the first entry of the tree at exactly mA and tanb (0 if there is
+  /// no such entry); reads the tree on each call
+  float scan(const std::string& var, float mA, float tanb);
+  /// bilinear interpolation of grid for a list of points; points out of range are set to fallback
+  void interpolate(const float* grid, const std::vector<float>& mA, const std::vector<float>& tanb, std::vector<float>& values, float fallback) const;
   
  private:
   /// verbosity level
   bool verbose_;
-  /// min and max of tanb scan
-  double minTanb_, maxTanb_, stepTanb_;
-  /// min and max of mA scan
-  double minMA_, maxMA_, stepMA_;
+  /// number of points, min and max of tanb scan
+  unsigned int nTanb_; double minTanb_, maxTanb_, stepTanb_;
+  /// number of points, min and max of mA scan
+  unsigned int nMA_; double minMA_, maxMA_, stepMA_;
   /// input file containing cross section and BR information
   TFile* file_;
   /// input tree containing cross section and BR information
   TTree* tree_;
-  /// 2d projection of the information of interst 
-  TH2F* hproject_;
-  /// 2d conrtrol plot to make sure that the scan went OK
-  TH2F* hscan_;
+  /// flat file containing cross section and BR information (alternative to file_ and tree_)
+  FlatGrid flat_;
+  /// name of the tree (prefix of the grids in the flat file)
+  std::string prefix_;
+  /// values of mA and tanb of the grid points as found in the tree (0 before the first grid has been
+  /// filled). These are the grids "mA" and "tanb"
+  const float* nodeMA_; const float* nodeTanb_;
+  /// false if any cell of the grid holds more than one entry of the tree or any entry is outside
+  /// of the grid (determined when the grid points are filled)
+  bool regular_;
+  /// grids of values for all variables that have been requested so far, key is the branch name
+  std::map<std::string, const float*> tables_;
+  /// memory of all grids that have been read from the tree
+  std::map<std::string, std::vector<float> > grids_;
 
   /// input parameters 
   float tanb_, mA_, var_;
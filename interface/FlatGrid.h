@@ -0,0 +1,233 @@
+#ifndef FlatGrid_h
+#define FlatGrid_h
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+   \class   FlatGrid FlatGrid.h "HiggsAnalysis/HiggsToTauTau/interface/FlatGrid.h"
+
+   \brief   Class to write and to memory map a binary file of 2d grids of floats
+
+   This is a class to hold a set of 2d grids (e.g. cross sections, branching ratios or masses as a
+   function of mA and tanb) in a single flat binary file, that can be mapped into memory instead of
+   being read. The file is mapped read-only and shared, such that all processes on a node that use
+   the same file share the same physical memory, and the opening of the file does not depend on the
+   size of its content. The file consists of:
+
+    - a header of 16 bytes: the magic string "HTTFLAT" (8 bytes), the version of the format and the
+      number of grids (unsigned 32 bit integers each);
+    - one record per grid: the name of the grid (96 bytes, null terminated), the number of points in
+      x and in y (unsigned 32 bit integers), the range in x and in y (xmin, xmax, ymin, ymax as
+      doubles) and the offset of the values from the beginning of the file (unsigned 64 bit integer);
+    - the values of all grids as contiguous arrays of nx x ny floats (the index in y running fastest),
+      each array aligned to 64 bytes.
+
+   All numbers are stored in the byte order of the machine that wrote the file. The binning follows
+   that of a TH2F with fixed bin sizes: the value of point (ix, iy) is valid in the cell [xmin+ix*dx,
+   xmin+(ix+1)*dx) x [ymin+iy*dy, ymin+(iy+1)*dy). By convention flat files carry the extension
+   ".flat". The class is fully implemented in this header, such that it can also be used from within
+   the ROOT macros.
+*/
+
+class FlatGrid {
+
+ public:
+  /// record of a single grid in the header of the file
+  struct Record {
+    /// name of the grid
+    char name[96];
+    /// number of points in x and in y
+    uint32_t nx, ny;
+    /// range in x and in y
+    double xmin, xmax, ymin, ymax;
+    /// offset of the values from the beginning of the file in bytes
+    uint64_t offset;
+  };
+  /// a single grid to be written to file
+  struct Grid {
+    /// name of the grid
+    std::string name;
+    /// number of points in x and in y
+    unsigned int nx, ny;
+    /// range in x and in y
+    double xmin, xmax, ymin, ymax;
+    /// values of the grid (nx x ny, the index in y running fastest)
+    std::vector<float> values;
+  };
+
+ public:
+  /// default constructor
+  FlatGrid() : data_(0), size_(0) {};
+  /// default destructor
+  ~FlatGrid() { close(); };
+
+  /// true if filename carries the extension of a flat file
+  static bool flat(const char* filename) { std::string name(filename); return name.size()>5 && name.substr(name.size()-5)==".flat"; };
+  /// write a list of grids to file; returns false if the file could not be written
+  static bool write(const char* filename, const std::vector<Grid>& grids);
+  /// map file into memory; returns false if the file could not be opened or is not a flat file
+  bool open(const char* filename);
+  /// unmap the file
+  void close();
+  /// true if a file is mapped
+  bool isOpen() const { return data_!=0; };
+  /// return the record of the grid with given name; returns 0 if no such grid exists
+  const Record* find(const std::string& name) const { std::map<std::string, const Record*>::const_iterator record=records_.find(name); return record==records_.end() ? 0 : record->second; };
+  /// return the values of the grid of a given record
+  const float* values(const Record& record) const { return (const float*)(data_+record.offset); };
+  /// return the value of grid name at (x, y); returns fallback if the grid does not exist or the point
+  /// is out of range
+  float value(const std::string& name, double x, double y, float fallback=0.) const;
+  /// names of all grids in the file
+  std::vector<std::string> names() const;
+
+ private:
+  /// copying would unmap the file twice
+  FlatGrid(const FlatGrid&);
+  /// copying would unmap the file twice
+  FlatGrid& operator=(const FlatGrid&);
+  /// size of the file header in bytes, rounded up to the alignment of the values
+  static uint64_t header(uint32_t ngrids) { return align(16+ngrids*sizeof(Record)); };
+  /// round a number of bytes up to the alignment of the values
+  static uint64_t align(uint64_t size) { return (size+63)/64*64; };
+
+ private:
+  /// begin of the mapped file
+  const char* data_;
+  /// size of the mapped file in bytes
+  size_t size_;
+  /// records of all grids in the file, key is the name of the grid
+  std::map<std::string, const Record*> records_;
+};
+
+inline bool
+FlatGrid::write(const char* filename, const std::vector<Grid>& grids)
+{
+  std::vector<Record> records(grids.size());
+  uint64_t offset = header(grids.size());
+  for(unsigned int igrid=0; igrid<grids.size(); ++igrid){
+    const Grid& grid = grids[igrid];
+    if( grid.name.size()>=sizeof(records[igrid].name) || grid.values.size()!=grid.nx*grid.ny ){
+      std::cout << "ERROR: grid " << grid.name << " has a too long name or an inconsistent number of values" << std::endl;
+      return false;
+    }
+    Record& record = records[igrid];
+    memset(&record, 0, sizeof(Record));
+    strncpy(record.name, grid.name.c_str(), sizeof(record.name)-1);
+    record.nx = grid.nx; record.ny = grid.ny;
+    record.xmin = grid.xmin; record.xmax = grid.xmax; record.ymin = grid.ymin; record.ymax = grid.ymax;
+    record.offset = offset;
+    offset += align(grid.values.size()*sizeof(float));
+  }
+  std::ofstream file(filename, std::ios::out | std::ios::binary);
+  if( !file ){
+    return false;
+  }
+  char magic[8] = "HTTFLAT";
+  uint32_t version = 1, ngrids = grids.size();
+  file.write(magic, sizeof(magic));
+  file.write((const char*)&version, sizeof(version));
+  file.write((const char*)&ngrids , sizeof(ngrids ));
+  if( !records.empty() ){
+    file.write((const char*)&records[0], records.size()*sizeof(Record));
+  }
+  std::vector<char> padding(64, 0);
+  file.write(&padding[0], header(grids.size())-16-records.size()*sizeof(Record));
+  for(unsigned int igrid=0; igrid<grids.size(); ++igrid){
+    uint64_t size = grids[igrid].values.size()*sizeof(float);
+    if( size>0 ){
+      file.write((const char*)&grids[igrid].values[0], size);
+    }
+    file.write(&padding[0], align(size)-size);
+  }
+  return file.good();
+}
+
+inline bool
+FlatGrid::open(const char* filename)
+{
+  close();
+  int fd = ::open(filename, O_RDONLY);
+  if( fd<0 ){
+    std::cout << "ERROR: could not open file " << filename << std::endl;
+    return false;
+  }
+  struct stat info;
+  if( fstat(fd, &info)!=0 || info.st_size<16 ){
+    std::cout << "ERROR: file " << filename << " is not a flat file" << std::endl;
+    ::close(fd);
+    return false;
+  }
+  void* data = mmap(0, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  // the mapping stays valid after the file descriptor has been closed
+  ::close(fd);
+  if( data==MAP_FAILED ){
+    std::cout << "ERROR: could not map file " << filename << std::endl;
+    return false;
+  }
+  data_ = (const char*)data; size_ = info.st_size;
+  uint32_t version = *(const uint32_t*)(data_+8), ngrids = *(const uint32_t*)(data_+12);
+  if( strncmp(data_, "HTTFLAT", 8)!=0 || version!=1 || header(ngrids)>size_ ){
+    std::cout << "ERROR: file " << filename << " is not a flat file or has an unknown version" << std::endl;
+    close();
+    return false;
+  }
+  const Record* records = (const Record*)(data_+16);
+  for(uint32_t igrid=0; igrid<ngrids; ++igrid){
+    if( records[igrid].offset+(uint64_t)records[igrid].nx*records[igrid].ny*sizeof(float)>size_ ){
+      std::cout << "ERROR: file " << filename << " is truncated" << std::endl;
+      close();
+      return false;
+    }
+    records_[std::string(records[igrid].name)] = &records[igrid];
+  }
+  return true;
+}
+
+inline void
+FlatGrid::close()
+{
+  if( data_ ){
+    munmap((void*)data_, size_);
+  }
+  data_ = 0; size_ = 0; records_.clear();
+}
+
+inline float
+FlatGrid::value(const std::string& name, double x, double y, float fallback) const
+{
+  const Record* record = find(name);
+  if( !record || !(record->xmin<=x && x<record->xmax && record->ymin<=y && y<record->ymax) ){
+    return fallback;
+  }
+  // same binning as TAxis::FindFixBin
+  unsigned int ix = (unsigned int)(record->nx*(x-record->xmin)/(record->xmax-record->xmin));
+  unsigned int iy = (unsigned int)(record->ny*(y-record->ymin)/(record->ymax-record->ymin));
+  if( ix>=record->nx || iy>=record->ny ){
+    return fallback;
+  }
+  return values(*record)[ix*record->ny+iy];
+}
+
+inline std::vector<std::string>
+FlatGrid::names() const
+{
+  std::vector<std::string> names;
+  for(std::map<std::string, const Record*>::const_iterator record=records_.begin(); record!=records_.end(); ++record){
+    names.push_back(record->first);
+  }
+  return names;
+}
+
+#endif
@@ -16,6 +16,8 @@
 #include <cmath>
 #include <fstream>
 #include <string>
+#include <vector>
+#include <algorithm>
 
 #include "TROOT.h"
 #include "TF1.h"
@@ -23,6 +25,8 @@
 #include "TCanvas.h"
 #include "TSpline.h"
 
+#include "HiggsAnalysis/HiggsToTauTau/interface/SharedTables.h"
+
 
 /**********************************************************/
 /*            Class for Higgs Width and CS                */
@@ -55,6 +59,15 @@ class HiggsCSandWidth
 
  public:
 
+  // CS and all of its uncertainties at a single mass
+  struct CSandErrors {
+    CSandErrors(double cs, double err) : CS(cs), ErrPlus(err), ErrMinus(err), ScaleErrPlus(err), ScaleErrMinus(err), PdfErrPlus(err), PdfErrMinus(err) {}
+    double CS;
+    double ErrPlus, ErrMinus;
+    double ScaleErrPlus, ScaleErrMinus;
+    double PdfErrPlus, PdfErrMinus;
+  };
+
   HiggsCSandWidth();
   ~HiggsCSandWidth();
 
@@ -67,24 +80,64 @@ class HiggsCSandWidth
   double HiggsCSpdfErrMinus(int ID, double mH, double sqrts);
   double HiggsWidth(int ID,double mH, bool spline);
   double HiggsBR(int ID,double mH, bool spline);
+  CSandErrors HiggsCSandErrors(int ID, double mH, double sqrts, bool spline);
 
  private:
 
-  double scratchMass;
-  double mass_BR[217];
-  double mass_XS[197];
-  double BR[26][217];
-  double CS[6][197];
-  double CSerrPlus[6][197];
-  double CSerrMinus[6][197];
-  double CSscaleErrPlus[6][197];
-  double CSscaleErrMinus[6][197];
-  double CSpdfErrPlus[6][197];
-  double CSpdfErrMinus[6][197];
+  // index of the closest mass below (or at) mH on a mass table, step to the next mass and distance to mH
+  struct MassIndex {
+    int i;
+    double step;
+    double deltaX;
+  };
+
+  // tables read from the text files in data/SM4; there is only one copy of them, which is shared
+  // by all instances (see SharedTables)
+  struct Tables {
+    double mass_BR[217];
+    double mass_XS[197];
+    double BR[26][217];
+    double CS[6][197];
+    double CSerrPlus[6][197];
+    double CSerrMinus[6][197];
+    double CSscaleErrPlus[6][197];
+    double CSscaleErrMinus[6][197];
+    double CSpdfErrPlus[6][197];
+    double CSpdfErrMinus[6][197];
+    // spline coefficients of the cubic starting at mass index i-1 (see SplineCoeff)
+    double BRspline[26][217][4];
+    double CSspline[6][197][4];
+    // version of the tables in the binary cache; to be increased with any change of the members,
+    // of Read or of SplineCoeff (see SharedTables)
+    static const unsigned int version = 1;
+
+    void Read();
+  };
+
+  const Tables& tables;
+  const double (&mass_BR)[217];
+  const double (&mass_XS)[197];
+  const double (&BR)[26][217];
+  const double (&CS)[6][197];
+  const double (&CSerrPlus)[6][197];
+  const double (&CSerrMinus)[6][197];
+  const double (&CSscaleErrPlus)[6][197];
+  const double (&CSscaleErrMinus)[6][197];
+  const double (&CSpdfErrPlus)[6][197];
+  const double (&CSpdfErrMinus)[6][197];
+  const double (&BRspline)[26][217][4];
+  const double (&CSspline)[6][197][4];
 
   int N_BR;
   int N_CS;
-  std::string FileLoc;
+
+  static const Tables& GetTables();
+  static void SplineCoeff(const double* mass, const double* value, int N, double (*coeff)[4]);
+  double SplineEval(const double* mass, const double (*coeff)[4], int N, int i, double mH) const;
+  MassIndex Locate(const double* mass, int N, double mH) const;
+  double Interpolate(double low, double high, const MassIndex& index) const;
+  double Interpolate(const double* value, const MassIndex& index) const;
+  double HiggsCSErr(const double (*err)[197], int ID, double mH, double sqrts) const;
 
 
 };
@@ -92,12 +145,56 @@ class HiggsCSandWidth
 
 using namespace std;
 
-HiggsCSandWidth::HiggsCSandWidth()
+HiggsCSandWidth::HiggsCSandWidth() :
+  tables(GetTables()),
+  mass_BR(tables.mass_BR),
+  mass_XS(tables.mass_XS),
+  BR(tables.BR),
+  CS(tables.CS),
+  CSerrPlus(tables.CSerrPlus),
+  CSerrMinus(tables.CSerrMinus),
+  CSscaleErrPlus(tables.CSscaleErrPlus),
+  CSscaleErrMinus(tables.CSscaleErrMinus),
+  CSpdfErrPlus(tables.CSpdfErrPlus),
+  CSpdfErrMinus(tables.CSpdfErrMinus),
+  BRspline(tables.BRspline),
+  CSspline(tables.CSspline)
 {
 
   N_BR = 217;
   N_CS = 197;
 
+}
+
+
+HiggsCSandWidth::~HiggsCSandWidth()
+{
+  //destructor
+
+}
+
+
+// The tables are read from the text files only once per process, or restored from the binary
+// cache HiggsCSandWidth.cache in $HTT_TABLE_CACHE if it is up to date
+const HiggsCSandWidth::Tables& HiggsCSandWidth::GetTables(){
+
+  std::string path = std::string(getenv("CMSSW_BASE"))+std::string("/src/HiggsAnalysis/HiggsToTauTau/data/SM4/");
+  const char* files[] = { "HiggsBR_7TeV_Official.txt", "HiggsCS_Official.txt", "HiggsCS_ErrorPlus_Official.txt", "HiggsCS_ErrorMinus_Official.txt",
+			  "HiggsCS_ScaleErrorPlus_Official.txt", "HiggsCS_ScaleErrorMinus_Official.txt", "HiggsCS_PdfErrorPlus_Official.txt", "HiggsCS_PdfErrorMinus_Official.txt" };
+  std::vector<std::string> sources;
+  for(unsigned int k = 0; k < sizeof(files)/sizeof(files[0]); k++){ sources.push_back(path+files[k]); }
+  return SharedTables<Tables>::get("HiggsCSandWidth.cache", sources);
+}
+
+
+void HiggsCSandWidth::Tables::Read()
+{
+
+  const int N_BR = 217;
+  const int N_CS = 197;
+  double scratchMass;
+  std::string FileLoc;
+
   ifstream file;
  
   // Read Widths into memory
@@ -157,13 +254,68 @@ HiggsCSandWidth::HiggsCSandWidth()
   }
   file.close();
 
+  // Precompute the spline coefficients for all tables
+  for(int id = 0; id < 26; id++){ SplineCoeff(mass_BR, BR[id], N_BR, BRspline[id]); }
+  for(int id = 0; id < 6; id++){ SplineCoeff(mass_XS, CS[id], N_CS, CSspline[id]); }
+
 }
 
 
-HiggsCSandWidth::~HiggsCSandWidth()
-{
-  //destructor
+// A TSpline3 through the four points mass[i-1]..mass[i+2] with its default (not-a-knot) end
+// conditions is the cubic polynomial through these points. Its coefficients are kept in Newton
+// form for each i, such that the spline can be evaluated without creating any TGraph or TSpline3.
+void HiggsCSandWidth::SplineCoeff(const double* mass, const double* value, int N, double (*coeff)[4]){
+
+  for(int i = 0; i < N; i++){
+    coeff[i][0] = coeff[i][1] = coeff[i][2] = coeff[i][3] = 0;
+    if(i < 1 || i+2 >= N){continue;}
+    const double* x = mass + i-1;
+    double d01 = (value[i  ]-value[i-1])/(x[1]-x[0]);
+    double d12 = (value[i+1]-value[i  ])/(x[2]-x[1]);
+    double d23 = (value[i+2]-value[i+1])/(x[3]-x[2]);
+    double d012 = (d12-d01)/(x[2]-x[0]);
+    double d123 = (d23-d12)/(x[3]-x[1]);
+    coeff[i][0] = value[i-1];
+    coeff[i][1] = d01;
+    coeff[i][2] = d012;
+    coeff[i][3] = (d123-d012)/(x[3]-x[0]);
+  }
+}
+
+
+double HiggsCSandWidth::SplineEval(const double* mass, const double (*coeff)[4], int N, int i, double mH) const{
+
+  if(i < 1){i = 1;}
+  if(i+2 >= N){i = N - 3;}
+  const double* c = coeff[i];
+  return c[0] + (mH-mass[i-1])*(c[1] + (mH-mass[i])*(c[2] + (mH-mass[i+1])*c[3]));
+}
+
+
+// Locate mH on a mass table: i is the index of the closest mass below (or at) mH. The tables are
+// sorted, such that a binary search replaces the hand-coded step ranges of each function.
+HiggsCSandWidth::MassIndex HiggsCSandWidth::Locate(const double* mass, int N, double mH) const{
 
+  MassIndex index;
+  index.i = (int)(std::upper_bound(mass, mass+N, mH) - mass) - 1;
+  if(index.i < 0){index.i = 0;}
+  index.deltaX = mH - mass[index.i];
+  index.step = index.i+1 < N ? mass[index.i+1] - mass[index.i] : 0;
+  return index;
+}
+
+
+double HiggsCSandWidth::Interpolate(double low, double high, const MassIndex& index) const{
+
+  if(index.deltaX == 0){ return low;}
+  double slope = (high - low)/index.step;
+  return slope*index.deltaX + low;
+}
+
+
+double HiggsCSandWidth::Interpolate(const double* value, const MassIndex& index) const{
+
+  return Interpolate(value[index.i], index.deltaX == 0 ? value[index.i] : value[index.i+1], index);
 }
 
 
@@ -178,138 +330,76 @@ double HiggsCSandWidth::HiggsCS(int ID, double mH, double sqrts, bool spline){
   /*       ttH = 5          */
   /*     Total = 0          */
   /**************************/
- 
-  int i = 0;
-  double closestMass = 0;
-  double reqCS = 0;
-  double tmpLow = 0, tmpHigh = 0;
-  double deltaX = 0, deltaY = 0;
-  double slope = 0;
-  double step = 0;
 
-
-  // If ID is unavailable return -1                                                                                                
+  // If ID is unavailable return -1
   if(ID > ID_ttH || ID < ID_Total){return -1;}
   // If Ecm is not 7 TeV return -1
   if(sqrts != 7){return -1;}
   //Don't interpolate btw 0 and numbers for mH300
   if(ID > ID_VBF && mH > 300){return 0;}
-
-
-  // If mH is out of range return -1                                           
-  // else find what array number to read         
+  // If mH is out of range return -1
   if( mH < 90 || mH > 1000){return -1;}
-  else{
-
-    if(mH <= 110 ){step = 5; i = (int)((mH - 90)/step); closestMass = (int)(step*i + 90);}
-    if(mH > 110 && mH <= 140 ){step = 0.5; i = (int)(4 + (mH - 110)/step); closestMass = (step*(i-4) + 110);}
-    if(mH > 140 && mH <= 160 ){step = 1; i = (int)(64 + (mH - 140)/step); closestMass = (int)(step*(i-64) + 140);}
-    if(mH > 160 && mH <= 290 ){step = 2; i = (int)(84 + (mH - 160)/step); closestMass = (int)(step*(i-84) + 160);}
-    if(mH > 290 && mH <= 350 ){step = 5; i = (int)(149 + (mH - 290)/step); closestMass = (int)(step*(i-149) + 290);}
-    if(mH > 350 && mH <= 400 ){step = 10; i = (int)(161 + (mH-350)/step); closestMass = (int)(step*(i-161) + 350);}
-    if(mH > 400){step = 20; i = (int)(166 + (mH-400)/step); closestMass = (int)(step*(i-166) + 400);}
-
-      tmpLow = CS[ID][i];
-      tmpHigh = CS[ID][i+1];
-
-      deltaX = mH - closestMass;
-
-      deltaY = tmpHigh - tmpLow;
-      slope = deltaY/step;
-
-      if(!spline)
-	{
-	  if(deltaX == 0){ reqCS = tmpLow;}
-	  else{ reqCS = slope*deltaX + tmpLow;}
-	}
-      else if(spline)
-	{
-	  if(i < 1){i = 1;}
-	  if(i+2 >= N_CS){i = N_CS - 3;}
-	  static const int index = 4;
-	  double xmh[index], sig[index];
-	  xmh[0]=mass_XS[i-1];xmh[1]=mass_XS[i];xmh[2]=mass_XS[i+1];xmh[3]=mass_XS[i+2];
-	  sig[0]=CS[ID][i-1]; sig[1]=CS[ID][i]; sig[2]=CS[ID][i+1]; sig[3]=CS[ID][i+2];
-	  
-	  TGraph *graph = new TGraph(index, xmh, sig);
-	  TSpline3 *gs = new TSpline3("gs",graph);
-	  gs->Draw();
-	  reqCS = gs->Eval(mH);
-	  delete gs;
-	  delete graph;
-	}
-      
-  }
-  
-  return reqCS;
-  
-}
-
 
-//Higgs CS takes process ID, higgs mass mH, and COM energy sqrts in TeV (numbers are for 7 TeV only in this version)                   
-double HiggsCSandWidth::HiggsCSErrPlus(int ID, double mH, double sqrts){
+  MassIndex index = Locate(mass_XS, N_CS, mH);
+  if(!spline){ return Interpolate(CS[ID], index);}
+  return SplineEval(mass_XS, CSspline[ID], N_CS, index.i, mH);
 
-  /**********IDs*************/
-  /*     ggToH = 1          */
-  /*       VBF = 2          */
-  /*        WH = 3          */
-  /*        ZH = 4          */
-  /*       ttH = 5          */
-  /**************************/
+}
 
-  int i = 0;
-  double closestMass = 0;
-  double reqCSerr = 0;
-  double tmpLow = 0, tmpHigh = 0;
-  double deltaX = 0, deltaY = 0;
-  double slope = 0;
-  double step = 0;
 
+// Uncertainties of the CS in the same conventions as the individual HiggsCSErr functions below
+double HiggsCSandWidth::HiggsCSErr(const double (*err)[197], int ID, double mH, double sqrts) const{
 
-  // If ID is unavailable return -1                                                                                    
+  // If ID is unavailable return -1
   if(ID > ID_ttH || ID < ID_Total){return -1;}
   if(ID == ID_Total){return 0;}
-  // If Ecm is not 7 TeV return -1                                                                                                
+  // If Ecm is not 7 TeV return -1
   if(sqrts != 7){return -1;}
-  //Don't interpolate btw 0 and numbers for mH300                        
+  //Don't interpolate btw 0 and numbers for mH300
   if(ID > ID_VBF && mH > 300){return 0;}
-
-  // If mH is out of range return -1                                                                        
-  // else find what array number to read                                          
+  // If mH is out of range return -1
   if( mH < 90 || mH > 1000){return -1;}
-  else{
 
-    if(mH <= 110 ){step = 5; i = (int)((mH - 90)/step); closestMass = (int)(step*i + 90);}
-    if(mH > 110 && mH <= 140 ){step = 0.5; i = (int)(4 + (mH - 110)/step); closestMass = (step*(i-4) + 110);}
-    if(mH > 140 && mH <= 160 ){step = 1; i = (int)(64 + (mH - 140)/step); closestMass = (int)(step*(i-64) + 140);}
-    if(mH > 160 && mH <= 290 ){step = 2; i = (int)(84 + (mH - 160)/step); closestMass = (int)(step*(i-84) + 160);}
-    if(mH > 290 && mH <= 350 ){step = 5; i = (int)(149 + (mH - 290)/step); closestMass = (int)(step*(i-149) + 290);}
-    if(mH > 350 && mH <= 400 ){step = 10; i = (int)(161 + (mH-350)/step); closestMass = (int)(step*(i-161) + 350);}
-    if(mH > 400){step = 20; i = (int)(166 + (mH-400)/step); closestMass = (int)(step*(i-166) + 400);}
+  return Interpolate(err[ID], Locate(mass_XS, N_CS, mH))*.01; //Account for percentage
 
+}
 
 
-    tmpLow = CSerrPlus[ID][i];
-    tmpHigh = CSerrPlus[ID][i+1];
-
-    deltaX = mH - closestMass;
-
-    deltaY = tmpHigh - tmpLow;
-    slope = deltaY/step;
+//Higgs CS and all of its uncertainties from a single lookup of mH; each value is the same as the one
+//of the corresponding individual function
+HiggsCSandWidth::CSandErrors HiggsCSandWidth::HiggsCSandErrors(int ID, double mH, double sqrts, bool spline){
 
-    // For partial widths                                                                                                      
-    if(deltaX == 0){ reqCSerr = tmpLow;}
-    else{ reqCSerr = slope*deltaX + tmpLow;}
-    reqCSerr *= .01; //Account for percentage
-  }
+  /**********IDs*************/ 
+  /*     ggToH = 1          */
+  /*       VBF = 2          */ 
+  /*        WH = 3          */ 
+  /*        ZH = 4          */
+  /*       ttH = 5          */
+  /*     Total = 0          */
+  /**************************/
 
-  return reqCSerr;
+  // Return values for an unavailable ID, Ecm or mH as for the individual functions
+  if(ID > ID_ttH || ID < ID_Total){return CSandErrors(-1, -1);}
+  if(sqrts != 7){return CSandErrors(-1, ID == ID_Total ? 0 : -1);}
+  if(ID > ID_VBF && mH > 300){return CSandErrors(0, 0);}
+  if( mH < 90 || mH > 1000){return CSandErrors(-1, ID == ID_Total ? 0 : -1);}
+
+  MassIndex index = Locate(mass_XS, N_CS, mH);
+  CSandErrors values(spline ? SplineEval(mass_XS, CSspline[ID], N_CS, index.i, mH) : Interpolate(CS[ID], index), 0);
+  if(ID == ID_Total){return values;}
+  values.ErrPlus       = Interpolate(CSerrPlus      [ID], index)*.01;
+  values.ErrMinus      = Interpolate(CSerrMinus     [ID], index)*.01;
+  values.ScaleErrPlus  = Interpolate(CSscaleErrPlus [ID], index)*.01;
+  values.ScaleErrMinus = Interpolate(CSscaleErrMinus[ID], index)*.01;
+  values.PdfErrPlus    = Interpolate(CSpdfErrPlus   [ID], index)*.01;
+  values.PdfErrMinus   = Interpolate(CSpdfErrMinus  [ID], index)*.01;
+  return values;
 
 }
 
 
-//Higgs CS takes process ID, higgs mass mH, and COM energy sqrts in TeV (numbers are for 7 TeV only in this version)      
-double HiggsCSandWidth::HiggsCSErrMinus(int ID, double mH, double sqrts){
+//Higgs CS takes process ID, higgs mass mH, and COM energy sqrts in TeV (numbers are for 7 TeV only in this version)
+double HiggsCSandWidth::HiggsCSErrPlus(int ID, double mH, double sqrts){
 
   /**********IDs*************/
   /*     ggToH = 1          */
@@ -319,58 +409,26 @@ double HiggsCSandWidth::HiggsCSErrMinus(int ID, double mH, double sqrts){
   /*       ttH = 5          */
   /**************************/
 
-  int i = 0;
-  double closestMass = 0;
-  double reqCSerr = 0;
-  double tmpLow = 0, tmpHigh = 0;
-  double deltaX = 0, deltaY = 0;
-  double slope = 0;
-  double step = 0;
-
-
-  // If ID is unavailable return -1                                                                                       
-  if(ID > ID_ttH || ID < ID_Total){return -1;}
-  if(ID == ID_Total){return 0;}
-  // If Ecm is not 7 TeV return -1                                                                                           
-  if(sqrts != 7){return -1;}
-  //Don't interpolate btw 0 and numbers for mH300                                                        
-  if(ID > ID_VBF && mH > 300){return 0;}
-
-
-  // If mH is out of range return -1                                                                           
-  // else find what array number to read                                                                 
-  if( mH < 90 || mH > 1000){return -1;}
-  else{
-
-    if(mH <= 110 ){step = 5; i = (int)((mH - 90)/step); closestMass = (int)(step*i + 90);}
-    if(mH > 110 && mH <= 140 ){step = 0.5; i = (int)(4 + (mH - 110)/step); closestMass = (step*(i-4) + 110);}
-    if(mH > 140 && mH <= 160 ){step = 1; i = (int)(64 + (mH - 140)/step); closestMass = (int)(step*(i-64) + 140);}
-    if(mH > 160 && mH <= 290 ){step = 2; i = (int)(84 + (mH - 160)/step); closestMass = (int)(step*(i-84) + 160);}
-    if(mH > 290 && mH <= 350 ){step = 5; i = (int)(149 + (mH - 290)/step); closestMass = (int)(step*(i-149) + 290);}
-    if(mH > 350 && mH <= 400 ){step = 10; i = (int)(161 + (mH-350)/step); closestMass = (int)(step*(i-161) + 350);}
-    if(mH > 400){step = 20; i = (int)(166 + (mH-400)/step); closestMass = (int)(step*(i-166) + 400);}
-
-
+  return HiggsCSErr(CSerrPlus, ID, mH, sqrts);
 
-    tmpLow = CSerrMinus[ID][i];
-    tmpHigh = CSerrMinus[ID][i+1];
-
-    deltaX = mH - closestMass;
+}
 
-    deltaY = tmpHigh - tmpLow;
-    slope = deltaY/step;
+//Higgs CS takes process ID, higgs mass mH, and COM energy sqrts in TeV (numbers are for 7 TeV only in this version)
+double HiggsCSandWidth::HiggsCSErrMinus(int ID, double mH, double sqrts){
 
-    // For partial widths                                               
-    if(deltaX == 0){ reqCSerr = tmpLow;}
-    else{ reqCSerr = slope*deltaX + tmpLow;}
-    reqCSerr *= .01; //Account for percentage                                                                                                   
-  }
+  /**********IDs*************/
+  /*     ggToH = 1          */
+  /*       VBF = 2          */
+  /*        WH = 3          */
+  /*        ZH = 4          */
+  /*       ttH = 5          */
+  /**************************/
 
-  return reqCSerr;
+  return HiggsCSErr(CSerrMinus, ID, mH, sqrts);
 
 }
 
-//Higgs CS takes process ID, higgs mass mH, and COM energy sqrts in TeV (numbers are for 7 TeV only in this version)          
+//Higgs CS takes process ID, higgs mass mH, and COM energy sqrts in TeV (numbers are for 7 TeV only in this version)
 double HiggsCSandWidth::HiggsCSscaleErrPlus(int ID, double mH, double sqrts){
 
   /**********IDs*************/
@@ -381,57 +439,11 @@ double HiggsCSandWidth::HiggsCSscaleErrPlus(int ID, double mH, double sqrts){
   /*       ttH = 5          */
   /**************************/
 
-  int i = 0;
-  double closestMass = 0;
-  double reqCSerr = 0;
-  double tmpLow = 0, tmpHigh = 0;
-  double deltaX = 0, deltaY = 0;
-  double slope = 0;
-  double step = 0;
-
-
-  // If ID is unavailable return -1                                                         
-  if(ID > ID_ttH || ID < ID_Total){return -1;}
-  if(ID == ID_Total){return 0;}
-  // If Ecm is not 7 TeV return -1                                                
-  if(sqrts != 7){return -1;}
-  //Don't interpolate btw 0 and numbers for mH300                                           
-  if(ID > ID_VBF && mH > 300){return 0;}
-
-  // If mH is out of range return -1                                                         
-  // else find what array number to read                                                      
-  if( mH < 90 || mH > 1000){return -1;}
-  else{
-
-    if(mH <= 110 ){step = 5; i = (int)((mH - 90)/step); closestMass = (int)(step*i + 90);}
-    if(mH > 110 && mH <= 140 ){step = 0.5; i = (int)(4 + (mH - 110)/step); closestMass = (step*(i-4) + 110);}
-    if(mH > 140 && mH <= 160 ){step = 1; i = (int)(64 + (mH - 140)/step); closestMass = (int)(step*(i-64) + 140);}
-    if(mH > 160 && mH <= 290 ){step = 2; i = (int)(84 + (mH - 160)/step); closestMass = (int)(step*(i-84) + 160);}
-    if(mH > 290 && mH <= 350 ){step = 5; i = (int)(149 + (mH - 290)/step); closestMass = (int)(step*(i-149) + 290);}
-    if(mH > 350 && mH <= 400 ){step = 10; i = (int)(161 + (mH-350)/step); closestMass = (int)(step*(i-161) + 350);}
-    if(mH > 400){step = 20; i = (int)(166 + (mH-400)/step); closestMass = (int)(step*(i-166) + 400);}
-
-
-
-    tmpLow = CSscaleErrPlus[ID][i];
-    tmpHigh = CSscaleErrPlus[ID][i+1];
-
-    deltaX = mH - closestMass;
-
-    deltaY = tmpHigh - tmpLow;
-    slope = deltaY/step;
-
-    // For partial widths                                              
-    if(deltaX == 0){ reqCSerr = tmpLow;}
-    else{ reqCSerr = slope*deltaX + tmpLow;}
-    reqCSerr *= .01; //Account for percentage                 
-  }
-
-  return reqCSerr;
+  return HiggsCSErr(CSscaleErrPlus, ID, mH, sqrts);
 
 }
 
-//Higgs CS takes process ID, higgs mass mH, and COM energy sqrts in TeV (numbers are for 7 TeV only in this version)    
+//Higgs CS takes process ID, higgs mass mH, and COM energy sqrts in TeV (numbers are for 7 TeV only in this version)
 double HiggsCSandWidth::HiggsCSscaleErrMinus(int ID, double mH, double sqrts){
 
   /**********IDs*************/
@@ -442,59 +454,11 @@ double HiggsCSandWidth::HiggsCSscaleErrMinus(int ID, double mH, double sqrts){
   /*       ttH = 5          */
   /**************************/
 
-  int i = 0;
-  double closestMass = 0;
-  double reqCSerr = 0;
-  double tmpLow = 0, tmpHigh = 0;
-  double deltaX = 0, deltaY = 0;
-  double slope = 0;
-  double step = 0;
-
-
-  // If ID is unavailable return -1                     
-  if(ID > ID_ttH || ID < ID_Total){return -1;}
-  if(ID == ID_Total){return 0;}
-  // If Ecm is not 7 TeV return -1                                                               
-  if(sqrts != 7){return -1;}
-  //Don't interpolate btw 0 and numbers for mH300                                   
-  if(ID > ID_VBF && mH > 300){return 0;}
-
-
-  // If mH is out of range return -1                        
-  // else find what array number to read                              
-  if( mH < 90 || mH > 1000){return -1;}
-  else{
-
-    if(mH <= 110 ){step = 5; i = (int)((mH - 90)/step); closestMass = (int)(step*i + 90);}
-    if(mH > 110 && mH <= 140 ){step = 0.5; i = (int)(4 + (mH - 110)/step); closestMass = (step*(i-4) + 110);}
-    if(mH > 140 && mH <= 160 ){step = 1; i = (int)(64 + (mH - 140)/step); closestMass = (int)(step*(i-64) + 140);}
-    if(mH > 160 && mH <= 290 ){step = 2; i = (int)(84 + (mH - 160)/step); closestMass = (int)(step*(i-84) + 160);}
-    if(mH > 290 && mH <= 350 ){step = 5; i = (int)(149 + (mH - 290)/step); closestMass = (int)(step*(i-149) + 290);}
-    if(mH > 350 && mH <= 400 ){step = 10; i = (int)(161 + (mH-350)/step); closestMass = (int)(step*(i-161) + 350);}
-    if(mH > 400){step = 20; i = (int)(166 + (mH-400)/step); closestMass = (int)(step*(i-166) + 400);}
-
-
-
-    tmpLow = CSscaleErrMinus[ID][i];
-    tmpHigh = CSscaleErrMinus[ID][i+1];
-
-    deltaX = mH - closestMass;
-
-    deltaY = tmpHigh - tmpLow;
-    slope = deltaY/step;
-
-    // For partial widths                                             
-    if(deltaX == 0){ reqCSerr = tmpLow;}
-    else{ reqCSerr = slope*deltaX + tmpLow;}
-    reqCSerr *= .01; //Account for percentage                                                                                          
-  }
-
-  return reqCSerr;
+  return HiggsCSErr(CSscaleErrMinus, ID, mH, sqrts);
 
 }
 
-
-//Higgs CS takes process ID, higgs mass mH, and COM energy sqrts in TeV (numbers are for 7 TeV only in this version)                  
+//Higgs CS takes process ID, higgs mass mH, and COM energy sqrts in TeV (numbers are for 7 TeV only in this version)
 double HiggsCSandWidth::HiggsCSpdfErrPlus(int ID, double mH, double sqrts){
 
   /**********IDs*************/
@@ -505,59 +469,11 @@ double HiggsCSandWidth::HiggsCSpdfErrPlus(int ID, double mH, double sqrts){
   /*       ttH = 5          */
   /**************************/
 
-  int i = 0;
-  double closestMass = 0;
-  double reqCSerr = 0;
-  double tmpLow = 0, tmpHigh = 0;
-  double deltaX = 0, deltaY = 0;
-  double slope = 0;
-  double step = 0;
-
-
-  // If ID is unavailable return -1                                                                           
-  if(ID > ID_ttH || ID < ID_Total){return -1;}
-  if(ID == ID_Total){return 0;}
-  // If Ecm is not 7 TeV return -1                                                                                         
-  if(sqrts != 7){return -1;}
-  //Don't interpolate btw 0 and numbers for mH300                                                  
-  if(ID > ID_VBF && mH > 300){return 0;}
-
-
-  // If mH is out of range return -1                                                                                  
-  // else find what array number to read                                                              
-  if( mH < 90 || mH > 1000){return -1;}
-  else{
-
-    if(mH <= 110 ){step = 5; i = (int)((mH - 90)/step); closestMass = (int)(step*i + 90);}
-    if(mH > 110 && mH <= 140 ){step = 0.5; i = (int)(4 + (mH - 110)/step); closestMass = (step*(i-4) + 110);}
-    if(mH > 140 && mH <= 160 ){step = 1; i = (int)(64 + (mH - 140)/step); closestMass = (int)(step*(i-64) + 140);}
-    if(mH > 160 && mH <= 290 ){step = 2; i = (int)(84 + (mH - 160)/step); closestMass = (int)(step*(i-84) + 160);}
-    if(mH > 290 && mH <= 350 ){step = 5; i = (int)(149 + (mH - 290)/step); closestMass = (int)(step*(i-149) + 290);}
-    if(mH > 350 && mH <= 400 ){step = 10; i = (int)(161 + (mH-350)/step); closestMass = (int)(step*(i-161) + 350);}
-    if(mH > 400){step = 20; i = (int)(166 + (mH-400)/step); closestMass = (int)(step*(i-166) + 400);}
-
-
-
-    tmpLow = CSpdfErrPlus[ID][i];
-    tmpHigh = CSpdfErrPlus[ID][i+1];
-
-    deltaX = mH - closestMass;
-
-    deltaY = tmpHigh - tmpLow;
-    slope = deltaY/step;
-
-    // For partial widths                    
-    if(deltaX == 0){ reqCSerr = tmpLow;}
-    else{ reqCSerr = slope*deltaX + tmpLow;}
-    reqCSerr *= .01; //Account for percentage                                                                                             
-  }
-
-  return reqCSerr;
+  return HiggsCSErr(CSpdfErrPlus, ID, mH, sqrts);
 
 }
 
-
-//Higgs CS takes process ID, higgs mass mH, and COM energy sqrts in TeV (numbers are for 7 TeV only in this version)         
+//Higgs CS takes process ID, higgs mass mH, and COM energy sqrts in TeV (numbers are for 7 TeV only in this version)
 double HiggsCSandWidth::HiggsCSpdfErrMinus(int ID, double mH, double sqrts){
 
   /**********IDs*************/
@@ -568,60 +484,11 @@ double HiggsCSandWidth::HiggsCSpdfErrMinus(int ID, double mH, double sqrts){
   /*       ttH = 5          */
   /**************************/
 
-  int i = 0;
-  double closestMass = 0;
-  double reqCSerr = 0;
-  double tmpLow = 0, tmpHigh = 0;
-  double deltaX = 0, deltaY = 0;
-  double slope = 0;
-  double step = 0;
-
-
-  // If ID is unavailable return -1                           
-  if(ID > ID_ttH || ID < ID_Total){return -1;}
-  if(ID == ID_Total){return 0;}
-  // If Ecm is not 7 TeV return -1                                                                 
-  if(sqrts != 7){return -1;}
-  //Don't interpolate btw 0 and numbers for mH300             
-  if(ID > ID_VBF && mH > 300){return 0;}
-
-
-  // If mH is out of range return -1                                                              
-  // else find what array number to read                            
-  if( mH < 90 || mH > 1000){return -1;}
-  else{
-
-    if(mH <= 110 ){step = 5; i = (int)((mH - 90)/step); closestMass = (int)(step*i + 90);}
-    if(mH > 110 && mH <= 140 ){step = 0.5; i = (int)(4 + (mH - 110)/step); closestMass = (step*(i-4) + 110);}
-    if(mH > 140 && mH <= 160 ){step = 1; i = (int)(64 + (mH - 140)/step); closestMass = (int)(step*(i-64) + 140);}
-    if(mH > 160 && mH <= 290 ){step = 2; i = (int)(84 + (mH - 160)/step); closestMass = (int)(step*(i-84) + 160);}
-    if(mH > 290 && mH <= 350 ){step = 5; i = (int)(149 + (mH - 290)/step); closestMass = (int)(step*(i-149) + 290);}
-    if(mH > 350 && mH <= 400 ){step = 10; i = (int)(161 + (mH-350)/step); closestMass = (int)(step*(i-161) + 350);}
-    if(mH > 400){step = 20; i = (int)(166 + (mH-400)/step); closestMass = (int)(step*(i-166) + 400);}
-
-
-
-    tmpLow = CSpdfErrMinus[ID][i];
-    tmpHigh = CSpdfErrMinus[ID][i+1];
-
-    deltaX = mH - closestMass;
-
-
-    deltaY = tmpHigh - tmpLow;
-    slope = deltaY/step;
-
-    // For partial widths                                                          
-    if(deltaX == 0){ reqCSerr = tmpLow;}
-    else{ reqCSerr = slope*deltaX + tmpLow;}
-    reqCSerr *= .01; //Account for percentage                                                                                    
-  }
-
-  return reqCSerr;
+  return HiggsCSErr(CSpdfErrMinus, ID, mH, sqrts);
 
 }
 
 
-
 // HiggsWidth takes process ID and higgs mass mH
 double HiggsCSandWidth::HiggsWidth(int ID, double mH, bool spline){
 
@@ -653,121 +520,26 @@ double HiggsCSandWidth::HiggsWidth(int ID, double mH, bool spline){
   /*  H->2nu2q (nu=any)(q=udcsb) = 23               */
   /*            H->4q (q=udcsb) = 24                */
   /*      H->4f (f=any fermion) = 25                */
-  /**************************************************/
-
-
 
-  double TotalWidth = 0;
-  double PartialWidth = 0;
-  double Width = 0;
-  int i = 0;
-  double closestMass = 0;
-  double tmpLow1, tmpHigh1, deltaX, deltaY1, slope1;
-  double deltaY2, tmpLow2, tmpHigh2, slope2, step;
 
 
-  // If ID is unavailable return -1                                           
+  // If ID is unavailable return -1
   if(ID > 25 || ID < 0){return -1;}
 
-
-  // If mH is out of range return -1                                            
-  // else find what array number to read                                        
+  // If mH is out of range return -1
   if( mH < 90 || mH > 1000){return -1;}
-  else{
-
-    //Find index and closest higgs mass for which we have numbers
-    if(mH <=110 ){step = 5; i = (int)((mH - 90)/step); closestMass = (int)(step*i + 90);}
-    if(mH > 110 && mH <= 140 ){step = 0.5; i = (int)(4 + (mH-110)/step); closestMass = (step*(i-4) + 110);}
-    if(mH > 140 && mH <= 160 ){step = 1; i = (int)(64 + (mH-140)/step); closestMass = (int)(step*(i-64) + 140);}
-    if(mH > 160 && mH <= 290 ){step = 2; i = (int)(84 + (mH-160)/step); closestMass = (int)(step*(i-84) + 160);}
-    if(mH > 290 && mH <= 350 ){step = 5; i = (int)(149 + (mH-290)/step); closestMass = (int)(step*(i-149) + 290);}
-    if(mH > 350 && mH <= 400 ){step = 10; i = (int)(161 + (mH-350)/step); closestMass = (int)(step*(i-161) + 350);}
-    if(mH > 400 && mH <= 600 ){step = 20; i = (int)(166 + (mH-400)/step); closestMass = (int)(step*(i-166) + 400);}
-    if(mH > 600){step = 10; i = (int)(176 + (mH-600)/step); closestMass = (int)(step*(i-176) + 600);}
-
-
-      tmpLow1 = BR[ID][i]*BR[0][i];                                                                                                                        
-      tmpHigh1 = BR[ID][i+1]*BR[0][i+1];                                                                                                                   
-
-
-      tmpLow2 = BR[0][i];
-      tmpHigh2 = BR[0][i+1];
-      deltaX = mH - closestMass;
-
-      deltaY1 = tmpHigh1 - tmpLow1;
-      slope1 = deltaY1/step;
-
-
-      deltaY2 = tmpHigh2 - tmpLow2;
-      slope2 = deltaY2/step;
-
-      if(!spline)
-	{
-	  // For partial widths                                                                                                                 
-	  if(deltaX == 0){ PartialWidth = tmpLow1;
-	    TotalWidth = tmpLow2;}
-	  else{ PartialWidth = slope1*deltaX + tmpLow1;
-	    TotalWidth = slope2*deltaX + tmpLow2;}
-	  // For total width  
-	  if( ID == 0 ){ Width = TotalWidth; }
-	  else{ Width = PartialWidth;}
-	}
-      else if(spline)
-	{
-	  if( ID == 0 )
-	    {
-	      if(i < 1){i = 1;}
-	      if(i+2 >= N_BR){i = N_BR - 3;}
-	      static const int indexW = 4;
-	      double xmhW[indexW], sigW[indexW];
-	      xmhW[0]=mass_BR[i-1];xmhW[1]=mass_BR[i];xmhW[2]=mass_BR[i+1];xmhW[3]=mass_BR[i+2];
-	      sigW[0]=BR[ID][i-1]; sigW[1]=BR[ID][i]; sigW[2]=BR[ID][i+1]; sigW[3]=BR[ID][i+2];
-	      
-	      TGraph *graphW = new TGraph(indexW, xmhW, sigW);
-	      TSpline3 *gsW = new TSpline3("gsW",graphW);
-	      gsW->Draw();
-	      Width = gsW->Eval(mH);
-	      delete gsW;
-	      delete graphW;
-	    }
-	  else{
-	      if(i < 1){i = 1;}
-	      if(i+2 >= N_BR){i = N_BR - 3;}
-
-	      static const int indexW = 4;
-	      double xmhW[indexW], sigW[indexW];
-	      xmhW[0]=mass_BR[i-1];xmhW[1]=mass_BR[i];xmhW[2]=mass_BR[i+1];xmhW[3]=mass_BR[i+2];
-	      sigW[0]=BR[0][i-1]; sigW[1]=BR[0][i]; sigW[2]=BR[0][i+1]; sigW[3]=BR[0][i+2];
-	      
-	      TGraph *graphW = new TGraph(indexW, xmhW, sigW);
-	      TSpline3 *gsW = new TSpline3("gsW",graphW);
-	      gsW->Draw();
-	      PartialWidth = gsW->Eval(mH);
-	      delete gsW;
-	      delete graphW;
-   
-	      static const int indexPW = 4;
-	      double xmhPW[indexPW], sigPW[indexPW];
-	      xmhPW[0]=mass_BR[i-1];xmhPW[1]=mass_BR[i];xmhPW[2]=mass_BR[i+1];xmhPW[3]=mass_BR[i+2];
-	      sigPW[0]=BR[ID][i-1]; sigPW[1]=BR[ID][i]; sigPW[2]=BR[ID][i+1]; sigPW[3]=BR[ID][i+2];
-	      
-	      TGraph *graphPW = new TGraph(indexPW, xmhPW, sigPW);
-	      TSpline3 *gsPW = new TSpline3("gsPW",graphPW);
-	      gsPW->Draw();
-	      PartialWidth *= gsPW->Eval(mH);
-	      delete gsPW;
-	      delete graphPW;
-
-	      Width = PartialWidth;
-	  
-	  }
-		  
-	}
-            
-  }
-  
-  return Width;
-  
+
+  MassIndex index = Locate(mass_BR, N_BR, mH);
+  if(!spline)
+    {
+      // For total width
+      if( ID == 0 ){ return Interpolate(BR[0], index);}
+      // For partial widths
+      return Interpolate(BR[ID][index.i]*BR[0][index.i], index.deltaX == 0 ? 0 : BR[ID][index.i+1]*BR[0][index.i+1], index);
+    }
+  if( ID == 0 ){ return SplineEval(mass_BR, BRspline[0], N_BR, index.i, mH);}
+  return SplineEval(mass_BR, BRspline[0], N_BR, index.i, mH)*SplineEval(mass_BR, BRspline[ID], N_BR, index.i, mH);
+
 } 
 
 
@@ -802,73 +574,18 @@ double HiggsCSandWidth::HiggsBR(int ID, double mH, bool spline){
   /*  H->2nu2q (nu=any)(q=udcsb) = 23               */
   /*            H->4q (q=udcsb) = 24                */
   /*      H->4f (f=any fermion) = 25                */
-  /**************************************************/
-
-
 
-  double PartialBR = 0;
-  double BranchRatio = 0;
-  int i = 0;
-  double closestMass = 0;
-  double tmpLow1, tmpHigh1, deltaX, deltaY1, slope1;
-  double step;
 
 
-  // If ID is unavailable return -1                                           
+  // If ID is unavailable return -1
   if(ID > 25 || ID < 1){return -1;}
 
-
-  // If mH is out of range return -1                                            
-  // else find what array number to read                                        
+  // If mH is out of range return -1
   if( mH < 90 || mH > 1000){return -1;}
-  else{
-
-    //Find index and closest higgs mass for which we have numbers
-    if(mH <=110 ){step = 5; i = (int)((mH - 90)/step); closestMass = (int)(step*i + 90);}
-    if(mH > 110 && mH <= 140 ){step = 0.5; i = (int)(4 + (mH-110)/step); closestMass = (step*(i-4) + 110);}
-    if(mH > 140 && mH <= 160 ){step = 1; i = (int)(64 + (mH-140)/step); closestMass = (int)(step*(i-64) + 140);}
-    if(mH > 160 && mH <= 290 ){step = 2; i = (int)(84 + (mH-160)/step); closestMass = (int)(step*(i-84) + 160);}
-    if(mH > 290 && mH <= 350 ){step = 5; i = (int)(149 + (mH-290)/step); closestMass = (int)(step*(i-149) + 290);}
-    if(mH > 350 && mH <= 400 ){step = 10; i = (int)(161 + (mH-350)/step); closestMass = (int)(step*(i-161) + 350);}
-    if(mH > 400 && mH <= 600 ){step = 20; i = (int)(166 + (mH-400)/step); closestMass = (int)(step*(i-166) + 400);}
-    if(mH > 600){step = 10; i = (int)(176 + (mH-600)/step); closestMass = (int)(step*(i-176) + 600);}
-
-
-      tmpLow1 = BR[ID][i];                                                                                                                        
-      tmpHigh1 = BR[ID][i+1];                                                                                                                   
-
-      deltaX = mH - closestMass;
-
-      deltaY1 = tmpHigh1 - tmpLow1;
-      slope1 = deltaY1/step;
-
-      if(!spline)
-	{
-	  if(deltaX == 0){ PartialBR = tmpLow1;}
-	  else{ PartialBR = slope1*deltaX + tmpLow1;}
-	}
-      else if(spline)
-	{
-	  if(i < 1){i = 1;}
-	  if(i+2 >= N_BR){i = N_BR - 3;}
-	  static const int indexBR = 4;
-	  double xmhBR[indexBR], sigBR[indexBR];
-	  xmhBR[0]=mass_BR[i-1];xmhBR[1]=mass_BR[i];xmhBR[2]=mass_BR[i+1];xmhBR[3]=mass_BR[i+2];
-	  sigBR[0]=BR[ID][i-1]; sigBR[1]=BR[ID][i]; sigBR[2]=BR[ID][i+1]; sigBR[3]=BR[ID][i+2];
-	  
-	  TGraph *graphBR = new TGraph(indexBR, xmhBR, sigBR);
-	  TSpline3 *gsBR = new TSpline3("gsBR",graphBR);
-	  gsBR->Draw();
-	  PartialBR = gsBR->Eval(mH);
-	  delete gsBR;
-	  delete graphBR;
-	}
-
-      BranchRatio = PartialBR;
-
-  }
 
-  return BranchRatio;
+  MassIndex index = Locate(mass_BR, N_BR, mH);
+  if(!spline){ return Interpolate(BR[ID], index);}
+  return SplineEval(mass_BR, BRspline[ID], N_BR, index.i, mH);
 
 } 
 
@@ -15,6 +15,9 @@
 #include <cmath>
 #include <fstream>
 #include <string>
+#include <vector>
+
+#include "HiggsAnalysis/HiggsToTauTau/interface/SharedTables.h"
 
 
 /**********************************************************/
@@ -73,25 +76,53 @@ class HiggsCSandWidthSM4
 
  private:
 
-  double scratchMass;
-  double BR[18][102];
-  double CS[6][109];
-  double mass_XS[109];
-  double mass_BR[102];
-  double mass_BR_gg[7];
-  double CSerrPlus[6][175];
-  double CSerrMinus[6][175];
-  double CSscaleErrPlus[6][175];
-  double CSscaleErrMinus[6][175];
-  double CSpdfErrPlus[6][175];
-  double CSpdfErrMinus[6][175];
+  // tables read from the text files in data/SM4; there is only one copy of them, which is shared
+  // by all instances (see SharedTables)
+  struct Tables {
+    double BR[18][102];
+    double CS[6][109];
+    double mass_XS[109];
+    double mass_BR[102];
+    double mass_BR_gg[7];
+    double CSerrPlus[6][175];
+    double CSerrMinus[6][175];
+    double CSscaleErrPlus[6][175];
+    double CSscaleErrMinus[6][175];
+    double CSpdfErrPlus[6][175];
+    double CSpdfErrMinus[6][175];
+    // spline coefficients of the cubic starting at mass index i-1 (see SplineCoeff)
+    double BRspline[18][102][4];
+    double CSspline[6][109][4];
+    // version of the tables in the binary cache; to be increased with any change of the members,
+    // of Read or of SplineCoeff (see SharedTables)
+    static const unsigned int version = 1;
+
+    void Read();
+  };
+
+  const Tables& tables;
+  const double (&BR)[18][102];
+  const double (&CS)[6][109];
+  const double (&mass_XS)[109];
+  const double (&mass_BR)[102];
+  const double (&mass_BR_gg)[7];
+  const double (&CSerrPlus)[6][175];
+  const double (&CSerrMinus)[6][175];
+  const double (&CSscaleErrPlus)[6][175];
+  const double (&CSscaleErrMinus)[6][175];
+  const double (&CSpdfErrPlus)[6][175];
+  const double (&CSpdfErrMinus)[6][175];
+  const double (&BRspline)[18][102][4];
+  const double (&CSspline)[6][109][4];
 
   int N_BR;
   int N_CS;
   int N_CSE;
   int N_BR_gg;
 
-  std::string FileLoc;
+  static const Tables& GetTables();
+  static void SplineCoeff(const double* mass, const double* value, int N, double (*coeff)[4]);
+  double SplineEval(const double* mass, const double (*coeff)[4], int N, int i, double mH) const;
 
 
 };
@@ -113,7 +144,21 @@ class HiggsCSandWidthSM4
 
 using namespace std;
 
-HiggsCSandWidthSM4::HiggsCSandWidthSM4()
+HiggsCSandWidthSM4::HiggsCSandWidthSM4() :
+  tables(GetTables()),
+  BR(tables.BR),
+  CS(tables.CS),
+  mass_XS(tables.mass_XS),
+  mass_BR(tables.mass_BR),
+  mass_BR_gg(tables.mass_BR_gg),
+  CSerrPlus(tables.CSerrPlus),
+  CSerrMinus(tables.CSerrMinus),
+  CSscaleErrPlus(tables.CSscaleErrPlus),
+  CSscaleErrMinus(tables.CSscaleErrMinus),
+  CSpdfErrPlus(tables.CSpdfErrPlus),
+  CSpdfErrMinus(tables.CSpdfErrMinus),
+  BRspline(tables.BRspline),
+  CSspline(tables.CSspline)
 {
 
   N_BR = 102;
@@ -121,6 +166,37 @@ HiggsCSandWidthSM4::HiggsCSandWidthSM4()
   N_CSE = 175;
   N_BR_gg = 6;
 
+}
+
+
+HiggsCSandWidthSM4::~HiggsCSandWidthSM4()
+{
+  //destructor
+
+}
+
+
+// The tables are read from the text files only once per process, or restored from the binary
+// cache HiggsCSandWidthSM4.cache in $HTT_TABLE_CACHE if it is up to date
+const HiggsCSandWidthSM4::Tables& HiggsCSandWidthSM4::GetTables(){
+
+  std::string path = std::string(getenv("CMSSW_BASE"))+std::string("/src/HiggsAnalysis/HiggsToTauTau/data/SM4/");
+  const char* files[] = { "Higgs_BR_SM4.txt", "Higgs_BR_SM4_Hgg.txt", "HiggsCS_Official_SM4.txt", "HiggsCS_Error_Official_SM4.txt" };
+  std::vector<std::string> sources;
+  for(unsigned int k = 0; k < sizeof(files)/sizeof(files[0]); k++){ sources.push_back(path+files[k]); }
+  return SharedTables<Tables>::get("HiggsCSandWidthSM4.cache", sources);
+}
+
+
+void HiggsCSandWidthSM4::Tables::Read()
+{
+
+  const int N_BR = 102;
+  const int N_CS = 109;
+  const int N_CSE = 175;
+  const int N_BR_gg = 6;
+  double scratchMass;
+
   ifstream file;
   double scratchHgg;
   // Read Widths into memory
@@ -152,13 +228,43 @@ HiggsCSandWidthSM4::HiggsCSandWidthSM4()
 	 >> CSpdfErrPlus[ID_ggToH][k] >> CSpdfErrMinus[ID_ggToH][k];
   }
   file.close();
+
+  // Precompute the spline coefficients for all tables (H->gamgam and the CS are only filled in part)
+  for(int id = 0; id < 18; id++){ SplineCoeff(id == 8 ? mass_BR_gg : mass_BR, BR[id], id == 8 ? N_BR_gg : N_BR, BRspline[id]); }
+  SplineCoeff(mass_XS, CS[ID_ggToH], N_CS, CSspline[ID_ggToH]);
 }
 
 
-HiggsCSandWidthSM4::~HiggsCSandWidthSM4()
-{
-  //destructor
+// A TSpline3 through the four points mass[i-1]..mass[i+2] with its default (not-a-knot) end
+// conditions is the cubic polynomial through these points. Its coefficients are kept in Newton
+// form for each i, such that the spline can be evaluated without creating any TGraph or TSpline3.
+void HiggsCSandWidthSM4::SplineCoeff(const double* mass, const double* value, int N, double (*coeff)[4]){
+
+  for(int i = 0; i < N; i++){
+    coeff[i][0] = coeff[i][1] = coeff[i][2] = coeff[i][3] = 0;
+    if(i < 1 || i+2 >= N){continue;}
+    const double* x = mass + i-1;
+    double d01 = (value[i  ]-value[i-1])/(x[1]-x[0]);
+    double d12 = (value[i+1]-value[i  ])/(x[2]-x[1]);
+    double d23 = (value[i+2]-value[i+1])/(x[3]-x[2]);
+    double d012 = (d12-d01)/(x[2]-x[0]);
+    double d123 = (d23-d12)/(x[3]-x[1]);
+    coeff[i][0] = value[i-1];
+    coeff[i][1] = d01;
+    coeff[i][2] = d012;
+    coeff[i][3] = (d123-d012)/(x[3]-x[0]);
+  }
+}
+
+
+double HiggsCSandWidthSM4::SplineEval(const double* mass, const double (*coeff)[4], int N, int i, double mH) const{
 
+  if(i < 1){i = 1;}
+  // the spline of the last interval is the one through the last four points of the table; the total
+  // width (HiggsWidth with ID 0) used to take a point past the end of the table for mH > 800 GeV
+  if(i+2 >= N){i = N - 3;}
+  const double* c = coeff[i];
+  return c[0] + (mH-mass[i-1])*(c[1] + (mH-mass[i])*(c[2] + (mH-mass[i+1])*c[3]));
 }
 
 
@@ -225,20 +331,7 @@ double HiggsCSandWidthSM4::HiggsCS(int ID, double mH, double sqrts, bool spline)
 	}
       else if(spline)
 	{
-	  if(i < 1){i = 1;}
-	  if(i+2 >= N_BR){i = N_BR - 3;}
-	  
-	  static const int indexSM4 = 4;
-	  double xmhSM4[indexSM4], sigSM4[indexSM4];
-	  xmhSM4[0]=mass_XS[i-1];xmhSM4[1]=mass_XS[i];xmhSM4[2]=mass_XS[i+1];xmhSM4[3]=mass_XS[i+2];
-	  sigSM4[0]=CS[ID][i-1]; sigSM4[1]=CS[ID][i]; sigSM4[2]=CS[ID][i+1]; sigSM4[3]=CS[ID][i+2];
-          
-	  TGraph *graphSM4 = new TGraph(indexSM4, xmhSM4, sigSM4);
-	  TSpline3 *gsSM4 = new TSpline3("gsSM4",graphSM4);
-	  gsSM4->Draw();
-	  reqCS = gsSM4->Eval(mH);
-	  delete gsSM4;
-	  delete graphSM4;
+	  reqCS = SplineEval(mass_XS, CSspline[ID], N_CS, i, mH);
 	}
      
 
@@ -718,47 +811,11 @@ double HiggsCSandWidthSM4::HiggsWidth(int ID, double mH, bool spline){
 	{
 	  if( ID == 0 )
 	    {
-	      if(i < 1){i = 1;}
-	      static const int indexWSM4 = 4;
-	      double xmhWSM4[indexWSM4], sigWSM4[indexWSM4];
-	      xmhWSM4[0]=mass_BR[i-1];xmhWSM4[1]=mass_BR[i];xmhWSM4[2]=mass_BR[i+1];xmhWSM4[3]=mass_BR[i+2];
-	      sigWSM4[0]=BR[ID][i-1]; sigWSM4[1]=BR[ID][i]; sigWSM4[2]=BR[ID][i+1]; sigWSM4[3]=BR[ID][i+2];
-	      
-	      TGraph *graphWSM4 = new TGraph(indexWSM4, xmhWSM4, sigWSM4);
-	      TSpline3 *gsWSM4 = new TSpline3("gsWSM4",graphWSM4);
-	      gsWSM4->Draw();
-	      Width = gsWSM4->Eval(mH);
-	      delete gsWSM4;
-	      delete graphWSM4;
+	      Width = SplineEval(mass_BR, BRspline[ID], N_BR, i, mH);
 	    }
 	  else{
-	    if(i < 1){i = 1;}
-	    if(i+2 >= N_BR){i = N_BR - 3;}
-	    if(ID == 8 && i+2 >= N_BR){i = N_BR_gg - 3;}
-
-	    static const int indexWSM4 = 4;
-	    double xmhWSM4[indexWSM4], sigWSM4[indexWSM4];
-	    xmhWSM4[0]=mass_BR[i-1];xmhWSM4[1]=mass_BR[i];xmhWSM4[2]=mass_BR[i+1];xmhWSM4[3]=mass_BR[i+2];
-	    sigWSM4[0]=BR[0][i-1]; sigWSM4[1]=BR[0][i]; sigWSM4[2]=BR[0][i+1]; sigWSM4[3]=BR[0][i+2];
-	    
-	    TGraph *graphWSM4 = new TGraph(indexWSM4, xmhWSM4, sigWSM4);
-	    TSpline3 *gsWSM4 = new TSpline3("gsWSM4",graphWSM4);
-	    gsWSM4->Draw();
-	    PartialWidth = gsWSM4->Eval(mH);
-	    delete gsWSM4;
-	    delete graphWSM4;
-	    
-	    static const int indexPWSM4 = 4;
-	    double xmhPWSM4[indexPWSM4], sigPWSM4[indexPWSM4];
-	    xmhPWSM4[0]=mass_BR[i-1];xmhPWSM4[1]=mass_BR[i];xmhPWSM4[2]=mass_BR[i+1];xmhPWSM4[3]=mass_BR[i+2];
-	    sigPWSM4[0]=BR[ID][i-1]; sigPWSM4[1]=BR[ID][i]; sigPWSM4[2]=BR[ID][i+1]; sigPWSM4[3]=BR[ID][i+2];
-	    
-	    TGraph *graphPWSM4 = new TGraph(indexPWSM4, xmhPWSM4, sigPWSM4);
-	    TSpline3 *gsPWSM4 = new TSpline3("gsPWSM4",graphPWSM4);
-	    gsPWSM4->Draw();
-	    PartialWidth *= gsPWSM4->Eval(mH);
-	    delete gsPWSM4;
-	    delete graphPWSM4;
+	    PartialWidth = SplineEval(mass_BR, BRspline[0], N_BR, i, mH);
+	    PartialWidth *= SplineEval(ID == 8 ? mass_BR_gg : mass_BR, BRspline[ID], ID == 8 ? N_BR_gg : N_BR, i, mH);
 	    
 	    Width = PartialWidth;
 	    
@@ -856,21 +913,7 @@ double HiggsCSandWidthSM4::HiggsBR(int ID, double mH, bool spline){
 	}
       else if(spline)
 	{
-	  if(i < 1){i = 1;}
-          if(i+2 >= N_BR){i = N_BR - 3;}
-          if(ID == 8 && i+2 >= N_BR){i = N_BR_gg - 3;}
-
-	  static const int indexBRSM4 = 4;
-	  double xmhBRSM4[indexBRSM4], sigBRSM4[indexBRSM4];
-	  xmhBRSM4[0]=mass_BR[i-1];xmhBRSM4[1]=mass_BR[i];xmhBRSM4[2]=mass_BR[i+1];xmhBRSM4[3]=mass_BR[i+2];
-	  sigBRSM4[0]=BR[ID][i-1]; sigBRSM4[1]=BR[ID][i]; sigBRSM4[2]=BR[ID][i+1]; sigBRSM4[3]=BR[ID][i+2];
-	  
-	  TGraph *graphBRSM4 = new TGraph(indexBRSM4, xmhBRSM4, sigBRSM4);
-	  TSpline3 *gsBRSM4 = new TSpline3("gsBRSM4",graphBRSM4);
-	  gsBRSM4->Draw();
-	  PartialBR = gsBRSM4->Eval(mH);
-	  delete gsBRSM4;
-	  delete graphBRSM4;
+	  PartialBR = SplineEval(ID == 8 ? mass_BR_gg : mass_BR, BRspline[ID], ID == 8 ? N_BR_gg : N_BR, i, mH);
 	}
 
       BranchRatio = PartialBR;
@@ -0,0 +1,141 @@
+#ifndef LimitCache_h
+#define LimitCache_h
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include "TFile.h"
+#include "TTree.h"
+#include "TString.h"
+
+/**
+   \class   LimitCache LimitCache.h "HiggsAnalysis/HiggsToTauTau/interface/LimitCache.h"
+
+   \brief   Class to buffer the content of the limit trees of combine output files in memory
+
+   This is a class to buffer the content of the output trees of combine, as they are used by the
+   class PlotLimits. On first request for a given file the tree is read in a single pass, with only
+   the requested branches enabled. All values (and, if requested, the corresponding values of
+   quantileExpected) are kept in memory in the order in which they appear in the tree. Any further
+   request for the same file and tree is served from memory. For an asymptotic limit this means
+   that the file of each mass point is opened once instead of once for the observed, the expected
+   and each of the four boundaries of the uncertainty bands.
+
+   With the function prefetch a list of files can be read concurrently by a configurable number of
+   threads before the values are requested one by one. The order in which values are requested (and
+   thus the order of the results) is not affected by this. ROOT is initialized for multi-threading
+   (TThread::Initialize) on first use of more than one thread.
+
+   With the function harvest the limit trees of all files higgsCombine*.root in all mass directories
+   of a limit directory are written into a single file (harvested-limits.root) in the limit directory.
+   This file contains one flat tree with the branches:
+
+    - mass     : mass of the mass directory
+    - name     : name of the combine output (e.g. "Test" or "-exp")
+    - method   : combine method (e.g. "Asymptotic" or "HybridNew")
+    - suffix   : remainder of the file name after the mass (e.g. ".quant0.500")
+    - quantile : value of quantileExpected
+    - limit    : value of limit
+    - mtime    : modification time of the combine output file when it was harvested
+    - size     : size of the combine output file when it was harvested
+
+   sorted by mass, name, method and suffix, and in the order of the original trees for each file. If
+   present, this file is picked up by the function load, which fills the buffer for all harvested
+   files in a single read. Files that changed since they were harvested (different modification
+   time or size) and files that are not contained in the harvested file are read from the mass
+   directory. Harvested files without the branches mtime and size are ignored.
+
+   For each buffered file the modification time and the size of the file are recorded when it is
+   read. With the function update all buffered files are checked for changes; changed files (and
+   files that did not exist when they were requested, but exist now) are dropped from the buffer and
+   re-read on next request. With the functions save and restore the buffer can be written to and
+   filled from a manifest file in text format, such that subsequent processes only need to read the
+   files that changed in between.
+*/
+
+class LimitCache {
+
+ public:
+  /// buffered content of a single tree
+  struct Entry {
+    /// default constructor
+    Entry() : valid(false), mtime(0), size(-1) {};
+    /// false if the file or the tree or the requested branch could not be found
+    bool valid;
+    /// values of quantileExpected in the order of the tree entries (empty if not requested)
+    std::vector<float> quantiles;
+    /// values of the requested branch in the order of the tree entries
+    std::vector<double> values;
+    /// path of the file
+    std::string fullpath;
+    /// modification time of the file when it was read (0 if the file did not exist)
+    Long_t mtime;
+    /// size of the file when it was read (-1 if the file did not exist)
+    Long64_t size;
+  };
+
+ public:
+  /// default constructor
+  LimitCache(unsigned int verbosity=0) : verbosity_(verbosity), opened_(0) {};
+  /// default destructor
+  ~LimitCache() {};
+
+  /// return the content of tree treename in file fullpath; the file is only read on first request. For
+  /// quantilename==0 no quantiles are read
+  const Entry& get(const char* fullpath, const char* treename="limit", const char* branchname="limit", const char* quantilename="quantileExpected");
+  /// function to receive the values of stream one by one; data is passed through from stream
+  typedef void (*Sink)(double value, void* data);
+  /// pass the values of branch branchname of tree treename in file fullpath to sink one by one,
+  /// without buffering them. The file is read on each call; it is counted in opened() and recorded
+  /// (w/o values), such that changes of the file are caught by update and save/restore. Returns
+  /// false if the file or the tree or the branch could not be found
+  bool stream(const char* fullpath, Sink sink, void* data, const char* treename="limit", const char* branchname="limit");
+  /// read the content of tree treename for a list of files concurrently with nthreads threads. Files
+  /// that have been read before are skipped
+  void prefetch(const std::vector<std::string>& fullpaths, unsigned int nthreads, const char* treename="limit", const char* branchname="limit", const char* quantilename="quantileExpected");
+  /// write the content of all higgsCombine*.root files in directory into a single harvested file;
+  /// returns the number of harvested files
+  unsigned int harvest(const char* directory, unsigned int nthreads=1);
+  /// fill the buffer from the harvested file in directory, if present; returns false if no harvested
+  /// file could be found. Each directory is only tried once
+  bool load(const char* directory);
+  /// check all buffered files for changes of their modification time or size; changed files are
+  /// dropped from the buffer. Returns the number of changed files
+  unsigned int update();
+  /// write the buffer to a manifest file (one line per file, the key and the path are terminated by
+  /// a tab); tag is free text to identify the content (e.g. a job)
+  bool save(const char* filename, const std::string& tag="") const;
+  /// fill the buffer from a manifest file written by save, skipping all files that changed since.
+  /// Returns the number of changed files or -1 if the manifest could not be read. If tag is given
+  /// it is filled with the tag of the manifest
+  int restore(const char* filename, std::string* tag=0);
+  /// number of files that have been opened so far
+  unsigned int opened() const { return opened_; };
+  /// drop all buffered content
+  void clear() { cache_.clear(); loaded_.clear(); };
+
+ private:
+  /// get modification time and size of a file; returns false if the file does not exist
+  static bool stat(const char* fullpath, Long_t& mtime, Long64_t& size);
+  /// key for the buffered content
+  std::string key(const char* fullpath, const char* treename, const char* branchname, const char* quantilename) const;
+  /// read the content of the tree from file (thread safe as long as each thread uses its own entry)
+  void read(Entry& entry, const char* fullpath, const char* treename, const char* branchname, const char* quantilename) const;
+  /// thread function for prefetch
+  static void* worker(void* job);
+
+ private:
+  /// verbosity level
+  unsigned int verbosity_;
+  /// number of files that have been opened so far
+  unsigned int opened_;
+  /// buffered content, key is built from file path, tree name and branch names
+  std::map<std::string, Entry> cache_;
+  /// directories for which a harvested file has been looked for
+  std::set<std::string> loaded_;
+};
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef OutputWriter_h
+#define OutputWriter_h
+
+#include <map>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "TMutex.h"
+#include "TObject.h"
+#include "TCondition.h"
+
+class TThread;
+
+/**
+   \class   OutputWriter OutputWriter.h "HiggsAnalysis/HiggsToTauTau/interface/OutputWriter.h"
+
+   \brief   Class to write the txt, tex and root output of the class PlotLimits in the background
+
+   This is a class to move the writing of the output files of the class PlotLimits off the main
+   thread. Text output (txt, tex) is handed over as a formatted string and queued right away. The
+   queues are worked off by a configurable number of worker threads. All writes to the same file
+   are executed by the same worker in the order of submission. By default (no worker threads) all
+   text output is written synchronously on the calling thread.
+
+   Objects for root output files (like the summary files <output>_<label>.root or limits_<label>.root
+   that are used by compareLimits.C) are cloned on submission, such that the caller is free to modify
+   or delete the originals. They are collected per file and per directory in the file for the whole
+   session. On flush each root file is opened once (in "update" mode as before), all objects of each
+   directory are written after a single change into that directory and the file is closed once, so
+   that the list of keys of the file is only rewritten once per session instead of once per plot.
+
+   There is only one instance per process (see instance). All pending output is written by flush,
+   which is called automatically at process end. Call flush explicitly if the output is needed
+   before (e.g. to read it back). Printing of canvases is not handled here: ROOT graphics are not
+   thread safe and canvases are still printed on the main thread.
+*/
+
+class OutputWriter {
+
+ public:
+  /// the single instance of the writer
+  static OutputWriter& instance();
+  /// set the number of worker threads (0: write synchronously on the calling thread); pending
+  /// writes are flushed before
+  void threads(unsigned int nthreads);
+  /// write content into text file filename
+  void write(const std::string& filename, const std::string& content);
+  /// queue a copy of object with name for directory of the root file filename; the object is written
+  /// on the next flush
+  void write(const std::string& filename, const std::string& directory, const TObject* object, const char* name);
+  /// write all queued objects into their root files and wait until all pending writes are done
+  void flush();
+
+ private:
+  /// objects to be written to a root file: name and object (owned) per directory
+  typedef std::map<std::string, std::vector<std::pair<std::string, TObject*> > > Summary;
+  /// single write request (either text or root output)
+  struct Task {
+    /// name of the output file
+    std::string filename;
+    /// content of a text file
+    std::string content;
+    /// content of a root file (empty for text files)
+    Summary summary;
+  };
+  /// queue of a single worker thread
+  struct Worker {
+    Worker() : condition(&mutex), stop(false), thread(0) {};
+    /// protection of tasks and stop
+    TMutex mutex;
+    /// signal for new tasks or stop
+    TCondition condition;
+    /// pending tasks
+    std::deque<Task> tasks;
+    /// indicate that the worker should stop once all tasks are done
+    bool stop;
+    /// thread of the worker
+    TThread* thread;
+  };
+
+ private:
+  /// private constructor, use instance
+  OutputWriter() : nthreads_(0) {};
+  /// private destructor
+  ~OutputWriter() {};
+  /// queue a task
+  void submit(const Task& task);
+  /// execute a single task
+  static void execute(Task& task);
+  /// thread function of the workers
+  static void* work(void* worker);
+  /// flush at process end
+  static void finish();
+
+ private:
+  /// number of worker threads
+  unsigned int nthreads_;
+  /// active workers (created on first write)
+  std::vector<Worker*> workers_;
+  /// objects to be written to root files per file name
+  std::map<std::string, Summary> summaries_;
+};
+
+#endif
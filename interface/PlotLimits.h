@@ -5,6 +5,7 @@
 #include <math.h>
 #include <vector>
 #include <fstream>
+#include <sstream>
 #include <iomanip>
 #include <iostream>
 #include <algorithm>
@@ -25,6 +26,10 @@
 
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 #include "HiggsAnalysis/HiggsToTauTau/interface/HttStyles.h"
+#include "HiggsAnalysis/HiggsToTauTau/interface/LimitCache.h"
+#include "HiggsAnalysis/HiggsToTauTau/interface/OutputWriter.h"
+#include "HiggsAnalysis/HiggsToTauTau/interface/Profile.h"
+#include "HiggsAnalysis/HiggsToTauTau/interface/ToyQuantiles.h"
 
 /**
    \class   Plotlimits PlotLimits.h "HiggsAnalysis/HiggsToTauTau/interface/PlotLimits.h"
@@ -54,7 +59,8 @@
       format.
 
     in the directory in which the tool plot has been executed. The names of the png/pdf/txt/tex output
-    files will be derived from the laypout and from the input directory. The output in the
+    files will be derived from the laypout and from the input directory. The txt, tex and root output
+    files are written in the background (see OutputWriter). The output in the
     root file will be updated in case a file with similar name is already present in the directory 
     where the tool plot has been executed or the file will be created otherwise. In the root file 
     the limits for a given input directory will be safed in a directory corresponding to the name of 
@@ -66,8 +72,9 @@
 class PlotLimits {
 
  public:
-  /// constructor from cfg file
-  PlotLimits(const char* output, const edm::ParameterSet& cfg);
+  /// constructor from cfg file; if cache is given the combine output files are buffered there instead of
+  /// in a private buffer, such that they can be shared between several instances (cache is not owned)
+  PlotLimits(const char* output, const edm::ParameterSet& cfg, LimitCache* cache=0);
   /// default destructor
   ~PlotLimits() {};
 
@@ -81,6 +88,8 @@ class PlotLimits {
   void print(const char* filename, TGraphAsymmErrors* outerBand, TGraphAsymmErrors* innerBand, TGraph* expected, TGraph* observed, const char* type="txt");
   /// print tabulated limits to a txt file, for inner band, outer band, expected and observed, with inner and outer band
   void print(const char* filename, std::string& xval, std::string& yval, std::vector<TGraph*> contour, const char* type="txt");
+  /// print canvas to file filename (the format is derived from the file ending)
+  void printCanvas(TCanvas& canv, const char* filename);
   /// automatic maximum determination for TGraphs (used for several options)
   float maximum(TGraph* graph); 
   /// make a fillable TGraph out of a non-fillable TGraph that comes out of a contour plot (used for option scan2D)
@@ -119,6 +128,8 @@ class PlotLimits {
   /// +2sigma :  0.975 quantile
   /// mean    : mean value of distribution 
   void prepareByToy(const char* directory, std::vector<double>& values, const char* type);
+  /// return mean, variance and quantiles of the toys in file fullpath; they are determined on first request
+  const ToyQuantiles& toyQuantiles(const char* fullpath);
   /// fill a single vector of values by value in the root input file with name filename (w/o .root ending). 
   /// Valid values are: 
   /// -1.     : observed
@@ -186,6 +197,12 @@ class PlotLimits {
   std::string label_;
   /// define verbosity level
   unsigned int verbosity_;
+  /// number of threads to read the files of all mass points concurrently (0, 1: sequential reading);
+  /// the number of threads to write the txt, tex and root output files in the background is given by
+  /// the parameter writeThreads (0: synchronous writing, default)
+  unsigned int threads_;
+  /// number of toys per mass point above which the quantiles are estimated by a streaming sketch (0: always exact)
+  unsigned int toySketch_;
 
   /// indicate whether mssm or sm plots should be made (used fro several options)
   bool mssm_;
@@ -218,6 +235,12 @@ class PlotLimits {
   std::vector<bool> valid_;
   /// mass for which a limit has been calculated (needed for plotting of HIG-XX-YYY results)
   std::vector<double> masses_;
+  /// private in memory buffer of the combine output files (used if no external buffer is given)
+  LimitCache buffer_;
+  /// in memory buffer of the combine output files; each file is only read once
+  LimitCache& cache_;
+  /// mean, variance and quantiles of the toy limits per file; each file is only evaluated once
+  std::map<std::string, ToyQuantiles> toys_;
 };
 
 /// official limits from HIG-11-020
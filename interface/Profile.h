@@ -0,0 +1,124 @@
+#ifndef Profile_h
+#define Profile_h
+
+#include <map>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include "TMutex.h"
+#include "Rtypes.h"
+
+/**
+   \class   Profile Profile.h "HiggsAnalysis/HiggsToTauTau/interface/Profile.h"
+
+   \brief   Class to collect timing and counters of the phases of the class PlotLimits
+
+   This is a class to collect the time spent in the phases of the class PlotLimits (like reading the
+   combine output files, determining the quantiles or printing the canvases) together with counters
+   (like the number of tree entries that have been read). Measurements are taken with the helper
+   class Profile::Timer, which measures the time between its construction and its destruction:
+
+   {
+     Profile::Timer timer("prepareByValue");
+     ...
+   }
+
+   As long as the profile is not enabled a timer does nothing but a single check. Once enabled a
+   summary of number of calls, total, mean and maximal time and counts per phase is printed by
+   finish, which is called automatically at process end. If a trace file is given all measurements
+   are in addition written to this file in the JSON trace event format (as understood by e.g.
+   chrome://tracing) such that they can be aggregated and inspected with external tools. If finish
+   is called more than once (e.g. once per pass of plot --watch) the events of all passes are
+   kept in the trace, each tagged with the number of its pass. Timers may be used from several
+   threads at the same time.
+
+   There is only one instance per process (see instance). The class PlotLimits enables it for
+   verbosity>0 or if the layout parameter profile is set: profile="summary" for the summary only,
+   profile="<file>.json" for the summary and the trace.
+*/
+
+class Profile {
+
+ public:
+  /// helper to measure the time of a single phase
+  class Timer {
+  public:
+    /// start the measurement of phase name
+    Timer(const char* name, Long64_t count=0);
+    /// stop the measurement and report it to the profile
+    ~Timer();
+    /// add to the counter of the phase
+    void count(Long64_t count) { count_+=count; };
+  private:
+    /// name of the phase (only set if the profile is enabled)
+    std::string name_;
+    /// counter
+    Long64_t count_;
+    /// start time in microseconds (<0 if the profile is not enabled)
+    double start_;
+  };
+
+ public:
+  /// the single instance of the profile
+  static Profile& instance();
+  /// enable the profile; if trace is not empty a trace is written to file trace on finish
+  void enable(const std::string& trace="");
+  /// true if the profile is enabled
+  bool active() const { return active_; };
+  /// add a measurement for phase name, start and stop in microseconds
+  void add(const std::string& name, double start, double stop, Long64_t count);
+  /// print the summary and append to the trace (if requested); all measurements are reset
+  void finish(std::ostream& out=std::cout);
+  /// current time in microseconds
+  static double now();
+
+ private:
+  /// summary of a single phase
+  struct Phase {
+    Phase() : calls(0), total(0.), max(0.), count(0) {};
+    /// number of measurements
+    unsigned int calls;
+    /// total and maximal time in microseconds
+    double total, max;
+    /// sum of counters
+    Long64_t count;
+  };
+  /// single measurement for the trace
+  struct Event {
+    /// name of the phase
+    std::string name;
+    /// start and duration in microseconds
+    double start, duration;
+    /// id of the thread
+    Long_t thread;
+    /// counter
+    Long64_t count;
+  };
+
+ private:
+  /// private constructor, use instance
+  Profile() : active_(false), passes_(0), traceEnd_(-1) {};
+  /// private destructor
+  ~Profile() {};
+  /// finish at process end
+  static void exit();
+
+ private:
+  /// indicate whether the profile is enabled
+  bool active_;
+  /// name of the trace file (empty for no trace)
+  std::string trace_;
+  /// protection of phases_ and events_
+  TMutex mutex_;
+  /// summary per phase
+  std::map<std::string, Phase> phases_;
+  /// all measurements in order of completion (only filled if a trace is requested)
+  std::vector<Event> events_;
+  /// number of calls of finish with measurements so far
+  unsigned int passes_;
+  /// position of the closing brackets in the trace file (<0 if it has not been written yet)
+  std::streamoff traceEnd_;
+};
+
+#endif
@@ -0,0 +1,193 @@
+#ifndef SharedTables_h
+#define SharedTables_h
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <typeinfo>
+
+#include <stdint.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+/**
+   \class   SharedTables SharedTables.h "HiggsAnalysis/HiggsToTauTau/interface/SharedTables.h"
+
+   \brief   Class template to share a set of tables read from text files between all instances of a class
+
+   This is a class template to hold a single copy of a set of tables of type T (e.g. the cross
+   sections and branching ratios of the classes HiggsCSandWidth and HiggsCSandWidthSM4), which is
+   shared by all instances and all threads of a process. The tables are filled on first request;
+   all further requests return the same copy. The initialization is protected by a mutex, such
+   that the tables can be requested from several threads at the same time.
+
+   To avoid the parsing of the text files in each process, the tables can be written to a binary
+   cache file after they have been read. The cache is only used if the environment variable
+   HTT_TABLE_CACHE points to a directory (e.g. $CMSSW_BASE/tmp), such that no files are written
+   next to the text files in the release area. On first request in any later process the tables
+   are restored from the cache file, if it is strictly newer than all text files it has been built
+   from and if its header matches the current code: the header holds the format of the cache, the
+   version of T, sizeof(T) and a hash of these, the type name of T and the paths and sizes of all
+   text files. Any change of the layout of T, of the way the tables are filled (including derived
+   values like spline coefficients) has to come with a new version of T. If the cache file cannot
+   be written the tables are read from the text files as before. The cache is written to a
+   temporary file first and then renamed, such that concurrent jobs never read a partially written
+   cache. The type T has to be a plain struct of arrays (it is written to and read from the cache
+   byte by byte) with a static constant unsigned int version and a member function void Read(),
+   which fills the tables from the text files.
+*/
+
+template<class T>
+class SharedTables {
+
+ public:
+  /// return the shared tables; cache is the name of the binary cache file (in the directory given by
+  /// HTT_TABLE_CACHE), sources the paths of the text files they are read from
+  static const T& get(const std::string& cache, const std::vector<std::string>& sources);
+
+ private:
+  /// format of the cache file, to be increased with any change of the header
+  static const uint32_t format = 2;
+  /// full path of the cache file; empty if no cache should be used
+  static std::string location(const std::string& cache);
+  /// hash of everything the validity of a cache depends on besides the modification times
+  static uint64_t identity(const std::vector<std::string>& sources);
+  /// modification time of a file; returns false if the file does not exist
+  static bool modified(const std::string& filename, time_t& mtime);
+  /// fill tables from the cache file; returns false if the cache does not exist, is out of date or
+  /// does not match the type T
+  static bool restore(T& tables, const std::string& cache, const std::vector<std::string>& sources);
+  /// write tables to the cache file; failures are ignored
+  static void save(const T& tables, const std::string& cache, const std::vector<std::string>& sources);
+};
+
+template<class T>
+const T&
+SharedTables<T>::get(const std::string& cache, const std::vector<std::string>& sources)
+{
+  static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+  static T* shared = 0;
+  pthread_mutex_lock(&mutex);
+  if( !shared ){
+    // value initialization, such that parts of the tables that are not filled are 0
+    T* tables = new T();
+    std::string path = location(cache);
+    if( path.empty() || !restore(*tables, path, sources) ){
+      tables->Read();
+      if( !path.empty() ){
+        save(*tables, path, sources);
+      }
+    }
+    shared = tables;
+  }
+  pthread_mutex_unlock(&mutex);
+  return *shared;
+}
+
+template<class T>
+std::string
+SharedTables<T>::location(const std::string& cache)
+{
+  const char* dir = getenv("HTT_TABLE_CACHE");
+  if( !dir || !*dir ){
+    return std::string();
+  }
+  return std::string(dir)+"/"+cache;
+}
+
+template<class T>
+uint64_t
+SharedTables<T>::identity(const std::vector<std::string>& sources)
+{
+  // FNV-1a
+  uint64_t hash = 14695981039346656037ULL;
+  std::string id = typeid(T).name();
+  char buffer[64];
+  sprintf(buffer, ":%u:%u:%lu", (unsigned int)format, (unsigned int)T::version, (unsigned long)sizeof(T));
+  id += buffer;
+  for(std::vector<std::string>::const_iterator filename=sources.begin(); filename!=sources.end(); ++filename){
+    struct stat info;
+    sprintf(buffer, ":%lld", ::stat(filename->c_str(), &info)==0 ? (long long)info.st_size : -1LL);
+    id += ":"+*filename+buffer;
+  }
+  for(std::string::const_iterator c=id.begin(); c!=id.end(); ++c){
+    hash ^= (unsigned char)*c;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+template<class T>
+bool
+SharedTables<T>::modified(const std::string& filename, time_t& mtime)
+{
+  struct stat info;
+  if( ::stat(filename.c_str(), &info)!=0 ){
+    return false;
+  }
+  mtime = info.st_mtime;
+  return true;
+}
+
+template<class T>
+bool
+SharedTables<T>::restore(T& tables, const std::string& cache, const std::vector<std::string>& sources)
+{
+  time_t mtime, source;
+  if( !modified(cache, mtime) ){
+    return false;
+  }
+  for(std::vector<std::string>::const_iterator filename=sources.begin(); filename!=sources.end(); ++filename){
+    // mtimes have a resolution of one second; a text file written in the same second as the cache
+    // might be newer
+    if( !modified(*filename, source) || source>=mtime ){
+      return false;
+    }
+  }
+  std::ifstream file(cache.c_str(), std::ios::in | std::ios::binary);
+  char magic[8]; uint32_t version[2] = {0, 0}; uint64_t size = 0, hash = 0;
+  file.read(magic, sizeof(magic));
+  file.read((char*)version, sizeof(version));
+  file.read((char*)&size, sizeof(size));
+  file.read((char*)&hash, sizeof(hash));
+  if( !file || strncmp(magic, "HTTCACHE", sizeof(magic))!=0 || version[0]!=format || version[1]!=T::version || size!=sizeof(T) || hash!=identity(sources) ){
+    return false;
+  }
+  file.read((char*)&tables, sizeof(T));
+  return file.gcount()==(std::streamsize)sizeof(T);
+}
+
+template<class T>
+void
+SharedTables<T>::save(const T& tables, const std::string& cache, const std::vector<std::string>& sources)
+{
+  char pid[32];
+  sprintf(pid, ".%d", (int)getpid());
+  std::string tmp = cache+pid;
+  {
+    std::ofstream file(tmp.c_str(), std::ios::out | std::ios::binary);
+    if( !file ){
+      return;
+    }
+    uint32_t version[2] = {format, T::version}; uint64_t size = sizeof(T), hash = identity(sources);
+    file.write("HTTCACHE", 8);
+    file.write((const char*)version, sizeof(version));
+    file.write((const char*)&size, sizeof(size));
+    file.write((const char*)&hash, sizeof(hash));
+    file.write((const char*)&tables, sizeof(T));
+    if( !file.good() ){
+      file.close();
+      remove(tmp.c_str());
+      return;
+    }
+  }
+  if( rename(tmp.c_str(), cache.c_str())!=0 ){
+    remove(tmp.c_str());
+  }
+}
+
+#endif
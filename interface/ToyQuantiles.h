@@ -0,0 +1,92 @@
+#ifndef ToyQuantiles_h
+#define ToyQuantiles_h
+
+#include <vector>
+
+/**
+   \class   ToyQuantiles ToyQuantiles.h "HiggsAnalysis/HiggsToTauTau/interface/ToyQuantiles.h"
+
+   \brief   Class to determine several quantiles, the mean and the variance of a toy distribution at once
+
+   This is a class to determine a fixed set of quantiles together with the mean and the variance of a
+   distribution of toy limits in a single pass over the input. It is used by the class PlotLimits to
+   determine the median and the +/-1sigma and +/-2sigma boundaries of the expected limit from the
+   batch_collected_*.root files of toy based limits.
+
+   By default all values are kept and the quantiles are determined exactly by selection
+   (std::nth_element), which for all requested quantiles together costs about one sort of the
+   distribution. As for a sorted vector the value for the probability p is the one at index
+   (int)(p*size()), evaluated in double precision. For sketch>0 the values are only kept as long as size()<=sketch. Once this size is
+   exceeded the quantiles are estimated with the P2 algorithm (R. Jain and I. Chlamtac, Communications
+   of the ACM 28 (1985) 1076), which needs only five markers per quantile, independent of the number
+   of toys. The mean and the variance are always exact.
+*/
+
+class ToyQuantiles {
+
+ public:
+  /// constructor for a list of probabilities (in the range ]0,1[)
+  ToyQuantiles(const std::vector<double>& probs=std::vector<double>(), unsigned int sketch=0);
+  /// default destructor
+  ~ToyQuantiles() {};
+
+  /// add a single value
+  void fill(double x);
+  /// add a list of values
+  void fill(const std::vector<double>& xs);
+  /// number of values that have been filled
+  unsigned int size() const { return n_; };
+  /// mean of all values
+  double mean() const { return mean_; };
+  /// variance of all values
+  double var() const { return sqr_-mean_*mean_; };
+  /// true if the quantiles are estimated by the P2 algorithm
+  bool sketched() const { return sketched_; };
+  /// value of the quantile for probability prob; prob has to be one of the probabilities given at
+  /// construction time. Returns -1 if no value has been filled or prob is not known
+  double quantile(double prob) const;
+
+ private:
+  /// markers of the P2 algorithm for a single quantile
+  struct Markers {
+    /// marker heights
+    double q[5];
+    /// actual marker positions
+    double n[5];
+    /// desired marker positions
+    double d[5];
+    /// increments of the desired marker positions
+    double inc[5];
+  };
+  /// switch from the buffered values to the P2 algorithm
+  void sketch();
+  /// update the P2 markers with a new value
+  void update(Markers& markers, double x);
+  /// determine all quantiles from the buffered values by selection
+  void select() const;
+
+ private:
+  /// probabilities of the quantiles (double, such that the index (int)(p*size()) is the same as
+  /// for the double literals used before)
+  std::vector<double> probs_;
+  /// maximal number of buffered values (0: no limit)
+  unsigned int max_;
+  /// number of filled values
+  unsigned int n_;
+  /// mean value
+  double mean_;
+  /// mean of the squared values
+  double sqr_;
+  /// indicate whether the P2 algorithm is in use
+  bool sketched_;
+  /// buffered values (partially ordered after select)
+  mutable std::vector<double> values_;
+  /// quantiles determined by select; only valid if selected_ is true
+  mutable std::vector<double> quantiles_;
+  /// indicate whether quantiles_ is up to date
+  mutable bool selected_;
+  /// P2 markers, one per quantile
+  std::vector<Markers> markers_;
+};
+
+#endif
@@ -3,15 +3,199 @@
 #include "TH2F.h"
 #include "TFile.h"
 #include "TObjString.h"
+#include <vector>
 #include <iostream>
 #include <cmath>
 
+// flat input files are memory mapped, which is only available from compiled code (ACLiC or the
+// binaries in bin); interpreted macros can only use ROOT input files
+class FlatGrid;
+
 class mssm_xs_tools{
  public:
+  // all tables of the input file; the table of quantity k_X is the histogram (or the grid of the
+  // flat file) h_X
+  enum Quantity {
+    k_brbb_h,	 //BR(h->bb)
+    k_brbb_H,	 //BR(H->bb)
+    k_brbb_A,	 //BR(A->bb)
+    k_brtautau_h,  //BR(h->tautau)
+    k_brtautau_H,	 //BR(H->tautau)								
+    k_brtautau_A,	 //BR(A->tautau)
+    k_brmumu_h,    //BR(h->mumu)
+    k_brmumu_H,	 //BR(H->mumu)	
+    k_brmumu_A,	 //BR(A->mumu)
+
+    // NB: ggF cross-sections are in fb
+    k_ggF_xsec_h,	   //   gg->h xsection (mA,tan(beta))
+    k_ggF_xsec_H,	   //   gg->H xsection (mA,tan(beta))
+    k_ggF_xsec_A,	   //   gg->A xsection (mA,tan(beta))
+    k_ggF_xsec05_h,  //	gg->h xsection (scale 0.5)(mA,tan(beta))
+    k_ggF_xsec05_H,  //	gg->H xsection (scale 0.5)(mA,tan(beta))
+    k_ggF_xsec05_A,  //	gg->A xsection (scale 0.5)(mA,tan(beta))
+    k_ggF_xsec20_h,  //	gg->h xsection (scale 2.0)(mA,tan(beta))
+    k_ggF_xsec20_H,  //	gg->H xsection (scale 2.0)(mA,tan(beta))
+    k_ggF_xsec20_A,  //	gg->A xsection (scale 2.0)(mA,tan(beta))
+
+    k_ggF_pdfup_h,  //	gg->h xsection PDF uncertainty+ (mA,tan(beta))
+    k_ggF_pdfup_H,  //	gg->H xsection PDF uncertainty+ (mA,tan(beta))
+    k_ggF_pdfup_A,  //	gg->A xsection PDF uncertainty+ (mA,tan(beta))
+    k_ggF_pdfdown_h,  //	gg->h xsection PDF uncertainty- (mA,tan(beta))
+    k_ggF_pdfdown_H,  //	gg->H xsection PDF uncertainty- (mA,tan(beta))
+    k_ggF_pdfdown_A,  //	gg->A xsection PDF uncertainty- (mA,tan(beta))
+
+    // NB: ggF_pdfalphas are all only pdf uncertainties; still need to add alphas unc. in quadrature
+    k_ggF_alphasup_h,  //	gg->h xsection PDFALPHAS uncertainty+ (mA,tan(beta))
+    k_ggF_alphasup_H,  //	gg->H xsection PDFALPHAS uncertainty+ (mA,tan(beta))
+    k_ggF_alphasup_A,  //	gg->A xsection PDFALPHAS uncertainty+ (mA,tan(beta))
+    k_ggF_alphasdown_h,  //	gg->h xsection PDFALPHAS uncertainty- (mA,tan(beta))
+    k_ggF_alphasdown_H,  //	gg->H xsection PDFALPHAS uncertainty- (mA,tan(beta))
+    k_ggF_alphasdown_A,  //	gg->A xsection PDFALPHAS uncertainty- (mA,tan(beta))
+
+    //ggFplusbbH5f combined
+    // NB: ggF cross-sections are in fb
+    k_ggFplusbbH_xsec_h,	   //   gg->h xsection (mA,tan(beta))
+    k_ggFplusbbH_xsec_H,	   //   gg->H xsection (mA,tan(beta))
+    k_ggFplusbbH_xsec_A,	   //   gg->A xsection (mA,tan(beta))
+    k_ggFplusbbH_xsec05_h,  //	gg->h xsection (scale 0.5)(mA,tan(beta))
+    k_ggFplusbbH_xsec05_H,  //	gg->H xsection (scale 0.5)(mA,tan(beta))
+    k_ggFplusbbH_xsec05_A,  //	gg->A xsection (scale 0.5)(mA,tan(beta))
+    k_ggFplusbbH_xsec20_h,  //	gg->h xsection (scale 2.0)(mA,tan(beta))
+    k_ggFplusbbH_xsec20_H,  //	gg->H xsection (scale 2.0)(mA,tan(beta))
+    k_ggFplusbbH_xsec20_A,  //	gg->A xsection (scale 2.0)(mA,tan(beta))
+
+    k_ggFplusbbH_pdfup_h,  //	gg->h xsection PDF uncertainty+ (mA,tan(beta))
+    k_ggFplusbbH_pdfup_H,  //	gg->H xsection PDF uncertainty+ (mA,tan(beta))
+    k_ggFplusbbH_pdfup_A,  //	gg->A xsection PDF uncertainty+ (mA,tan(beta))
+    k_ggFplusbbH_pdfdown_h,  //	gg->h xsection PDF uncertainty- (mA,tan(beta))
+    k_ggFplusbbH_pdfdown_H,  //	gg->H xsection PDF uncertainty- (mA,tan(beta))
+    k_ggFplusbbH_pdfdown_A,  //	gg->A xsection PDF uncertainty- (mA,tan(beta))
+
+    // NB: ggFplusbbH_pdfalphas are all only pdf uncertainties; still need to add alphas unc. in quadrature
+    k_ggFplusbbH_alphasup_h,  //	gg->h xsection PDFALPHAS uncertainty+ (mA,tan(beta))
+    k_ggFplusbbH_alphasup_H,  //	gg->H xsection PDFALPHAS uncertainty+ (mA,tan(beta))
+    k_ggFplusbbH_alphasup_A,  //	gg->A xsection PDFALPHAS uncertainty+ (mA,tan(beta))
+    k_ggFplusbbH_alphasdown_h,  //	gg->h xsection PDFALPHAS uncertainty- (mA,tan(beta))
+    k_ggFplusbbH_alphasdown_H,  //	gg->H xsection PDFALPHAS uncertainty- (mA,tan(beta))
+    k_ggFplusbbH_alphasdown_A,  //	gg->A xsection PDFALPHAS uncertainty- (mA,tan(beta))
+
+    k_bbH4f_xsec_h,  //	bbh xsection (mA,tan(beta))
+    k_bbH4f_xsec_H,  //	bbH xsection (mA,tan(beta))
+    k_bbH4f_xsec_A,  //	bbA xsection (mA,tan(beta))
+    k_bbH4f_xsec_h_low,  //	bbh xsection (mA,tan(beta))
+    k_bbH4f_xsec_H_low,  //	bbH xsection (mA,tan(beta))
+    k_bbH4f_xsec_A_low,  //	bbA xsection (mA,tan(beta))
+    k_bbH4f_xsec_h_high,  //	bbh xsection (mA,tan(beta))
+    k_bbH4f_xsec_H_high,  //	bbH xsection (mA,tan(beta))
+    k_bbH4f_xsec_A_high,  //	bbA xsection (mA,tan(beta))
+
+    k_bbH_xsec_h,  //	bb->h xsection (mA,tan(beta))
+    k_bbH_xsec_H,  //	bb->H xsection (mA,tan(beta))
+    k_bbH_xsec_A,  //	bb->A xsection (mA,tan(beta))
+
+    k_bbH_mufdown_h,  //	bb->h xsection muf unc.- (mA,tan(beta))
+    k_bbH_mufdown_H,  //	bb->H xsection muf unc.- (mA,tan(beta))
+    k_bbH_mufdown_A,  //	bb->A xsection muf unc.- (mA,tan(beta))
+    k_bbH_mufup_h,  //	bb->h xsection muf unc.+ (mA,tan(beta))
+    k_bbH_mufup_H,  //	bb->H xsection muf unc.+ (mA,tan(beta))
+    k_bbH_mufup_A,  //	bb->A xsection muf unc.+ (mA,tan(beta))
+
+    k_bbH_murdown_h,  //	bb->h xsection mur unc.- (mA,tan(beta))
+    k_bbH_murdown_H,  //	bb->H xsection mur unc.- (mA,tan(beta))
+    k_bbH_murdown_A,  //	bb->A xsection mur unc.- (mA,tan(beta))
+    k_bbH_murup_h,  //	bb->h xsection mur unc.+ (mA,tan(beta))
+    k_bbH_murup_H,  //	bb->H xsection mur unc.+ (mA,tan(beta))
+    k_bbH_murup_A,  //	bb->A xsection mur unc.+ (mA,tan(beta))
+
+    k_bbH_mudown_h,  //	bb->h xsection mu unc.- (mA,tan(beta))
+    k_bbH_mudown_H,  //	bb->H xsection mu unc.- (mA,tan(beta))
+    k_bbH_mudown_A,  //	bb->A xsection mu unc.- (mA,tan(beta))
+    k_bbH_muup_h,  //	bb->h xsection mu unc.+ (mA,tan(beta))
+    k_bbH_muup_H,  //	bb->H xsection mu unc.+ (mA,tan(beta))
+    k_bbH_muup_A,  //	bb->A xsection mu unc.+ (mA,tan(beta))
+
+    k_bbH_pdf68down_h,  //	bb->h xsection pdf68 unc.- (mA,tan(beta))
+    k_bbH_pdf68down_H,  //	bb->H xsection pdf68 unc.- (mA,tan(beta))
+    k_bbH_pdf68down_A,  //	bb->A xsection pdf68 unc.- (mA,tan(beta))
+    k_bbH_pdf68up_h,  //	bb->h xsection pdf68 unc.+ (mA,tan(beta))
+    k_bbH_pdf68up_H,  //	bb->H xsection pdf68 unc.+ (mA,tan(beta))
+    k_bbH_pdf68up_A,  //	bb->A xsection pdf68 unc.+ (mA,tan(beta))
+
+    k_bbH_pdf90down_h,  //	bb->h xsection pdf90 unc.- (mA,tan(beta))
+    k_bbH_pdf90down_H,  //	bb->H xsection pdf90 unc.- (mA,tan(beta))
+    k_bbH_pdf90down_A,  //	bb->A xsection pdf90 unc.- (mA,tan(beta))
+    k_bbH_pdf90up_h,  //	bb->h xsection pdf90 unc.+ (mA,tan(beta))
+    k_bbH_pdf90up_H,  //	bb->H xsection pdf90 unc.+ (mA,tan(beta))
+    k_bbH_pdf90up_A,  //	bb->A xsection pdf90 unc.+ (mA,tan(beta))
+
+    k_bbH_pdfalphas68down_h,  //	bb->h xsection pdfalphas68 unc.- (mA,tan(beta))
+    k_bbH_pdfalphas68down_H,  //	bb->H xsection pdfalphas68 unc.- (mA,tan(beta))
+    k_bbH_pdfalphas68down_A,  //	bb->A xsection pdfalphas68 unc.- (mA,tan(beta))
+    k_bbH_pdfalphas68up_h,  //	bb->h xsection pdfalphas68 unc.+ (mA,tan(beta))
+    k_bbH_pdfalphas68up_H,  //	bb->H xsection pdfalphas68 unc.+ (mA,tan(beta))
+    k_bbH_pdfalphas68up_A,  //	bb->A xsection pdfalphas68 unc.+ (mA,tan(beta))
+
+    k_bbH_pdfalphas90down_h,  //	bb->h xsection pdfalphas90 unc.- (mA,tan(beta))
+    k_bbH_pdfalphas90down_H,  //	bb->H xsection pdfalphas90 unc.- (mA,tan(beta))
+    k_bbH_pdfalphas90down_A,  //	bb->A xsection pdfalphas90 unc.- (mA,tan(beta))
+    k_bbH_pdfalphas90up_h,  //	bb->h xsection pdfalphas90 unc.+ (mA,tan(beta))
+    k_bbH_pdfalphas90up_H,  //	bb->H xsection pdfalphas90 unc.+ (mA,tan(beta))
+    k_bbH_pdfalphas90up_A,  //	bb->A xsection pdfalphas90 unc.+ (mA,tan(beta))
+
+    k_mh,  //	mh (mA,tan(beta))
+    k_mH,  //	mH (mA,tan(beta))
+    kNQuantities
+  };
+  // all quantities at a single point in (mA, tanb), indexed by Quantity
+  struct Point {
+    Double_t operator[](Quantity q) const { return values[q]; }
+    Float_t values[kNQuantities];
+  };
+  // read-only copy of all tables of an input file. The values are copied from the histograms (or
+  // the grids of a flat file) on construction; all queries are const and do not touch any ROOT
+  // object, such that a single snapshot can be queried from many threads at the same time without
+  // locks. Out of range queries return the under- or overflow bins of the histograms (0 for flat
+  // files), variable bin sizes are supported
+  class Snapshot {
+   public:
+    // copy all tables of the input file of tools (the histograms are read if necessary)
+    Snapshot(mssm_xs_tools& tools);
+    // value of quantity q at mA, tanb (same as the corresponding Give_* accessor of mssm_xs_tools)
+    Double_t value(Quantity q, Double_t mA, Double_t tanb) const;
+    // all quantities at mA, tanb (same as Give_Point of mssm_xs_tools)
+    Point point(Double_t mA, Double_t tanb) const;
+
+   private:
+    // a single table with the bin numbering of a TH2 (including under- and overflow bins)
+    struct Table {
+      // bin number of (x, y) as from TH2::FindBin
+      int bin(Double_t x, Double_t y) const;
+      // true if both axes have fixed bin sizes
+      bool fixed;
+      // number of bins in x and in y
+      int nx, ny;
+      // bin edges in x (nx+1) and in y (ny+1)
+      std::vector<Double_t> xedges, yedges;
+      // bin contents, (nx+2)*(ny+2) values (empty if the table does not exist)
+      std::vector<Float_t> values;
+    };
+    // true if two tables have the same binning
+    static bool same(const Table& a, const Table& b);
+
+    // tables of all quantities
+    std::vector<Table> m_tables;
+    // quantities that share the binning of the first existing table (m_reference)
+    std::vector<bool> m_shared;
+    int m_reference;
+  };
+
    mssm_xs_tools();
   ~mssm_xs_tools();
   // specify input file, could also be moved into constructor?
-  void SetInput(char* filename);
+  // files with extension .flat (as written by export-flat-grids) are mapped into memory; this needs
+  // the compiled macro (.L mssm_xs_tools.C+). Returns false if the file could not be opened, in which
+  // case all accessors return 0
+  bool SetInput(char* filename);
   // help method
   void help();
   // access BRs into bbbar
@@ -175,10 +359,16 @@ class mssm_xs_tools{
   Double_t Give_Mass_h(Double_t mA, Double_t tanb);
   Double_t Give_Mass_H(Double_t mA, Double_t tanb);
 
+  // access all cross sections, BRs, uncertainties and masses at (mA, tanb) from a single bin lookup;
+  // the first call reads all tables and packs the values of each bin into a contiguous block
+  Point Give_Point(Double_t mA, Double_t tanb);
+
   // Santander
   Double_t GiveXsec_Santander_h(Double_t mA, Double_t tanb);
   Double_t GiveXsec_Santander_H(Double_t mA, Double_t tanb);
   Double_t GiveXsec_Santander_A(Double_t mA, Double_t tanb);
+  // Santander matching of the 4 and 5 flavour scheme cross sections for a Higgs boson of mass mass
+  static Double_t Santander(Double_t mass, Double_t fourflav, Double_t fiveflav);
   
   Double_t GiveXsec_UncUp_Santander_H(Double_t mA, Double_t tanb, TString PDFCL);
   Double_t GiveXsec_UncUp_Santander_h(Double_t mA, Double_t tanb, TString PDFCL);
@@ -189,141 +379,35 @@ Double_t GiveXsec_UncDown_Santander_H(Double_t mA, Double_t tanb, TString PDFCL)
 
 
  private:
+  // value of the histogram (or of the grid in the flat file) of quantity q at mA, tanb
+  Double_t lookup(Quantity q, Double_t mA, Double_t tanb);
+  // histogram of quantity q; the histogram is read from the input file on first access, such
+  // that only the histograms in use are loaded. Returns 0 if the histogram does not exist
+  TH2F* table(Quantity q);
+  // pack all tables with the binning of the first table into m_packed (on first call of Give_Point)
+  void pack();
+  // values of quantity q in the flat input file and their binning; returns 0 if there is no flat
+  // input file or no such grid
+  const float* grid(Quantity q, int& nx, int& ny, Double_t& xmin, Double_t& xmax, Double_t& ymin, Double_t& ymax) const;
+
+  // names of the histograms of all quantities
+  static const char* s_names[kNQuantities];
+  // flat input file (alternative to m_input, 0 if none)
+  FlatGrid* m_flat;
   /////////////////////////////////////////////////////////////////////
-  // New out.root file contents (Yellow Report)
+  // New out.root file contents (Yellow Report), 0 if none
   TFile* m_input;
-  
-  TH2F* m_h_brbb_h;	 //BR(h->bb)
-  TH2F*	m_h_brbb_H;	 //BR(H->bb)
-  TH2F*	m_h_brbb_A;	 //BR(A->bb)
-  TH2F*	m_h_brtautau_h;  //BR(h->tautau)
-  TH2F*	m_h_brtautau_H;	 //BR(H->tautau)								
-  TH2F*	m_h_brtautau_A;	 //BR(A->tautau)
-  TH2F* m_h_brmumu_h;    //BR(h->mumu)
-  TH2F*	m_h_brmumu_H;	 //BR(H->mumu)	
-  TH2F* m_h_brmumu_A;	 //BR(A->mumu)
-  
-  // NB: ggF cross-sections are in fb
-  TH2F*	m_h_ggF_xsec_h;	   //   gg->h xsection (mA,tan(beta))
-  TH2F*	m_h_ggF_xsec_H;	   //   gg->H xsection (mA,tan(beta))
-  TH2F*	m_h_ggF_xsec_A;	   //   gg->A xsection (mA,tan(beta))
-  TH2F*	m_h_ggF_xsec05_h;  //	gg->h xsection (scale 0.5)(mA,tan(beta))
-  TH2F*	m_h_ggF_xsec05_H;  //	gg->H xsection (scale 0.5)(mA,tan(beta))
-  TH2F*	m_h_ggF_xsec05_A;  //	gg->A xsection (scale 0.5)(mA,tan(beta))
-  TH2F*	m_h_ggF_xsec20_h;  //	gg->h xsection (scale 2.0)(mA,tan(beta))
-  TH2F*	m_h_ggF_xsec20_H;  //	gg->H xsection (scale 2.0)(mA,tan(beta))
-  TH2F*	m_h_ggF_xsec20_A;  //	gg->A xsection (scale 2.0)(mA,tan(beta))
-
-  TH2F*	m_h_ggF_pdfup_h;  //	gg->h xsection PDF uncertainty+ (mA,tan(beta))
-  TH2F*	m_h_ggF_pdfup_H;  //	gg->H xsection PDF uncertainty+ (mA,tan(beta))
-  TH2F*	m_h_ggF_pdfup_A;  //	gg->A xsection PDF uncertainty+ (mA,tan(beta))
-  TH2F*	m_h_ggF_pdfdown_h;  //	gg->h xsection PDF uncertainty- (mA,tan(beta))
-  TH2F*	m_h_ggF_pdfdown_H;  //	gg->H xsection PDF uncertainty- (mA,tan(beta))
-  TH2F*	m_h_ggF_pdfdown_A;  //	gg->A xsection PDF uncertainty- (mA,tan(beta))
-
-  // NB: ggF_pdfalphas are all only pdf uncertainties; still need to add alphas unc. in quadrature
-  TH2F*	m_h_ggF_alphasup_h;  //	gg->h xsection PDFALPHAS uncertainty+ (mA,tan(beta))
-  TH2F*	m_h_ggF_alphasup_H;  //	gg->H xsection PDFALPHAS uncertainty+ (mA,tan(beta))
-  TH2F*	m_h_ggF_alphasup_A;  //	gg->A xsection PDFALPHAS uncertainty+ (mA,tan(beta))
-  TH2F*	m_h_ggF_alphasdown_h;  //	gg->h xsection PDFALPHAS uncertainty- (mA,tan(beta))
-  TH2F*	m_h_ggF_alphasdown_H;  //	gg->H xsection PDFALPHAS uncertainty- (mA,tan(beta))
-  TH2F*	m_h_ggF_alphasdown_A;  //	gg->A xsection PDFALPHAS uncertainty- (mA,tan(beta))
-
-  //ggFplusbbH5f combined
- // NB: ggF cross-sections are in fb
-  TH2F*	m_h_ggFplusbbH_xsec_h;	   //   gg->h xsection (mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_xsec_H;	   //   gg->H xsection (mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_xsec_A;	   //   gg->A xsection (mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_xsec05_h;  //	gg->h xsection (scale 0.5)(mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_xsec05_H;  //	gg->H xsection (scale 0.5)(mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_xsec05_A;  //	gg->A xsection (scale 0.5)(mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_xsec20_h;  //	gg->h xsection (scale 2.0)(mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_xsec20_H;  //	gg->H xsection (scale 2.0)(mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_xsec20_A;  //	gg->A xsection (scale 2.0)(mA,tan(beta))
-
-  TH2F*	m_h_ggFplusbbH_pdfup_h;  //	gg->h xsection PDF uncertainty+ (mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_pdfup_H;  //	gg->H xsection PDF uncertainty+ (mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_pdfup_A;  //	gg->A xsection PDF uncertainty+ (mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_pdfdown_h;  //	gg->h xsection PDF uncertainty- (mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_pdfdown_H;  //	gg->H xsection PDF uncertainty- (mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_pdfdown_A;  //	gg->A xsection PDF uncertainty- (mA,tan(beta))
-
-  // NB: ggFplusbbH_pdfalphas are all only pdf uncertainties; still need to add alphas unc. in quadrature
-  TH2F*	m_h_ggFplusbbH_alphasup_h;  //	gg->h xsection PDFALPHAS uncertainty+ (mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_alphasup_H;  //	gg->H xsection PDFALPHAS uncertainty+ (mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_alphasup_A;  //	gg->A xsection PDFALPHAS uncertainty+ (mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_alphasdown_h;  //	gg->h xsection PDFALPHAS uncertainty- (mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_alphasdown_H;  //	gg->H xsection PDFALPHAS uncertainty- (mA,tan(beta))
-  TH2F*	m_h_ggFplusbbH_alphasdown_A;  //	gg->A xsection PDFALPHAS uncertainty- (mA,tan(beta))
-
-
-
-
-  TH2F*	m_h_bbH4f_xsec_h;  //	bbh xsection (mA,tan(beta))
-  TH2F*	m_h_bbH4f_xsec_H;  //	bbH xsection (mA,tan(beta))
-  TH2F*	m_h_bbH4f_xsec_A;  //	bbA xsection (mA,tan(beta))
-  TH2F*	m_h_bbH4f_xsec_h_low;  //	bbh xsection (mA,tan(beta))
-  TH2F*	m_h_bbH4f_xsec_H_low;  //	bbH xsection (mA,tan(beta))
-  TH2F*	m_h_bbH4f_xsec_A_low;  //	bbA xsection (mA,tan(beta))
-  TH2F*	m_h_bbH4f_xsec_h_high;  //	bbh xsection (mA,tan(beta))
-  TH2F*	m_h_bbH4f_xsec_H_high;  //	bbH xsection (mA,tan(beta))
-  TH2F*	m_h_bbH4f_xsec_A_high;  //	bbA xsection (mA,tan(beta))
-
-  TH2F*	m_h_bbH_xsec_h;  //	bb->h xsection (mA,tan(beta))
-  TH2F*	m_h_bbH_xsec_H;  //	bb->H xsection (mA,tan(beta))
-  TH2F*	m_h_bbH_xsec_A;  //	bb->A xsection (mA,tan(beta))
-
-  TH2F*	m_h_bbH_mufdown_h;  //	bb->h xsection muf unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_mufdown_H;  //	bb->H xsection muf unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_mufdown_A;  //	bb->A xsection muf unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_mufup_h;  //	bb->h xsection muf unc.+ (mA,tan(beta))
-  TH2F*	m_h_bbH_mufup_H;  //	bb->H xsection muf unc.+ (mA,tan(beta))
-  TH2F*	m_h_bbH_mufup_A;  //	bb->A xsection muf unc.+ (mA,tan(beta))
-
-  TH2F*	m_h_bbH_murdown_h;  //	bb->h xsection mur unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_murdown_H;  //	bb->H xsection mur unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_murdown_A;  //	bb->A xsection mur unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_murup_h;  //	bb->h xsection mur unc.+ (mA,tan(beta))
-  TH2F*	m_h_bbH_murup_H;  //	bb->H xsection mur unc.+ (mA,tan(beta))
-  TH2F*	m_h_bbH_murup_A;  //	bb->A xsection mur unc.+ (mA,tan(beta))
-
-  TH2F*	m_h_bbH_mudown_h;  //	bb->h xsection mu unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_mudown_H;  //	bb->H xsection mu unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_mudown_A;  //	bb->A xsection mu unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_muup_h;  //	bb->h xsection mu unc.+ (mA,tan(beta))
-  TH2F*	m_h_bbH_muup_H;  //	bb->H xsection mu unc.+ (mA,tan(beta))
-  TH2F*	m_h_bbH_muup_A;  //	bb->A xsection mu unc.+ (mA,tan(beta))
-
-  TH2F*	m_h_bbH_pdf68down_h;  //	bb->h xsection pdf68 unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_pdf68down_H;  //	bb->H xsection pdf68 unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_pdf68down_A;  //	bb->A xsection pdf68 unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_pdf68up_h;  //	bb->h xsection pdf68 unc.+ (mA,tan(beta))
-  TH2F*	m_h_bbH_pdf68up_H;  //	bb->H xsection pdf68 unc.+ (mA,tan(beta))
-  TH2F*	m_h_bbH_pdf68up_A;  //	bb->A xsection pdf68 unc.+ (mA,tan(beta))
-
-  TH2F*	m_h_bbH_pdf90down_h;  //	bb->h xsection pdf90 unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_pdf90down_H;  //	bb->H xsection pdf90 unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_pdf90down_A;  //	bb->A xsection pdf90 unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_pdf90up_h;  //	bb->h xsection pdf90 unc.+ (mA,tan(beta))
-  TH2F*	m_h_bbH_pdf90up_H;  //	bb->H xsection pdf90 unc.+ (mA,tan(beta))
-  TH2F*	m_h_bbH_pdf90up_A;  //	bb->A xsection pdf90 unc.+ (mA,tan(beta))
-
-  TH2F*	m_h_bbH_pdfalphas68down_h;  //	bb->h xsection pdfalphas68 unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_pdfalphas68down_H;  //	bb->H xsection pdfalphas68 unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_pdfalphas68down_A;  //	bb->A xsection pdfalphas68 unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_pdfalphas68up_h;  //	bb->h xsection pdfalphas68 unc.+ (mA,tan(beta))
-  TH2F*	m_h_bbH_pdfalphas68up_H;  //	bb->H xsection pdfalphas68 unc.+ (mA,tan(beta))
-  TH2F*	m_h_bbH_pdfalphas68up_A;  //	bb->A xsection pdfalphas68 unc.+ (mA,tan(beta))
-
-  TH2F*	m_h_bbH_pdfalphas90down_h;  //	bb->h xsection pdfalphas90 unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_pdfalphas90down_H;  //	bb->H xsection pdfalphas90 unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_pdfalphas90down_A;  //	bb->A xsection pdfalphas90 unc.- (mA,tan(beta))
-  TH2F*	m_h_bbH_pdfalphas90up_h;  //	bb->h xsection pdfalphas90 unc.+ (mA,tan(beta))
-  TH2F*	m_h_bbH_pdfalphas90up_H;  //	bb->H xsection pdfalphas90 unc.+ (mA,tan(beta))
-  TH2F*	m_h_bbH_pdfalphas90up_A;  //	bb->A xsection pdfalphas90 unc.+ (mA,tan(beta))
-
-  TH2F*	m_h_mh;  //	mh (mA,tan(beta))
-  TH2F*	m_h_mH;  //	mH (mA,tan(beta))
+  // histograms of all quantities (0 if not read yet)
+  TH2F* m_hists[kNQuantities];
+
+  // values of all packed tables, kNQuantities consecutive values per bin (the index in tanb running
+  // fastest)
+  std::vector<Float_t> m_packed;
+  // quantities with a different binning or without table; these are taken from lookup
+  std::vector<int> m_unpacked;
+  // binning of the packed tables
+  int m_nx, m_ny;
+  Double_t m_xmin, m_xmax, m_ymin, m_ymax;
 
 };
 
@@ -25,6 +25,16 @@ layout = cms.PSet(
     root = cms.bool(True),
     ## define verbosity level
     verbosity = cms.uint32(0),
+    ## number of threads to read the mass points concurrently
+    threads = cms.uint32(1),
+    ## number of threads to write the txt, tex and root output in the background (0: synchronous)
+    writeThreads = cms.uint32(0),
+    ## number of toys per mass point above which the quantiles of toy based limits are estimated
+    ## with a bounded memory sketch (0: always exact)
+    toySketch = cms.uint32(0),
+    ## profile of the phases of the tool ("": off (unless verbosity>0), "summary": summary printout,
+    ## "<file>.json": summary printout and trace file)
+    profile = cms.string(""),
     ## define output label for root file
     outputLabel = cms.string("limit"),
     ## define masspoints for limit plot
@@ -1,70 +1,124 @@
 #include <cstdlib>
+#include <algorithm>
 #include "HiggsAnalysis/HiggsToTauTau/interface/CrossSection.h"
 
+CrossSection::Process
+CrossSection::process(const char* name)
+{
+  /// names in the order of the enum
+  static const char* names[] = { "ggH", "qqH", "WH", "ZH", "ttH", "BR", "ttbar", "W", "Z", "W-top", "top-t", "top-s", "WW", "WZ", "ZZ", "QCD", "VV" };
+  std::string proc(name);
+  for(unsigned int idx=0; idx<kUnknown; ++idx){
+    if(proc == names[idx]){
+      return (Process)idx;
+    }
+  }
+  return kUnknown;
+}
+
+void
+CrossSection::check(Process process)
+{
+  if(process == kUnknown){
+    std::cerr 
+      << "This proc is not implemented or does not exist." << std::endl
+      << "Available proc's are: ggH, qqH, WH, ZH, ttH, BR " << std::endl;
+    exit(0);
+  }
+}
+
+const CrossSection::Table&
+CrossSection::table(Process process)
+{
+  switch(process){
+  case kggH : return ggH();
+  case kqqH : return qqH();
+  case kWH  : return WH ();
+  case kZH  : return ZH ();
+  case kttH : return ttH();
+  default   : return BR ();
+  }
+}
+
 float 
-CrossSection::evaluate(const char* process, float mass)
+CrossSection::evaluate(const char* proc, float mass)
 {
-  float xsec=0.;
-  xsec_.clear();
-  std::string proc(process);
-  if(proc == std::string("ggH")){ ggH(); }
-  else if(proc == std::string("qqH")){ qqH(); }
-  else if(proc == std::string("WH" )){ WH (); }
-  else if(proc == std::string("ZH" )){ ZH (); }
-  else if(proc == std::string("ttH")){ ttH(); }
-  else if(proc == std::string("BR" )){ BR (); }
-  else if(!background(proc)){
+  Process process = CrossSection::process(proc);
+  if(process == kUnknown){
     std::cerr 
       << "This proc is not implemented or does not exist: " << proc << std::endl
       << "Available proc's are: ggH, qqH, WH, ZH, ttH, BR " << std::endl;
     exit(0);
   }
-  if(background(proc)){
+  return evaluate(process, mass);
+}
+
+float 
+CrossSection::evaluate(Process process, float mass)
+{
+  float xsec=0.;
+  check(process);
+  if(background(process)){
     // for backround processes return the scale to 
     // different ecms. Therefore xsec should be 1.
     xsec = 1.;
   }
   else{
-    xsec = linear(mass, xsec_);
+    xsec = linear(mass, table(process));
   }
-  if(proc != std::string("BR")){
+  if(process != kBR){
     // do not apply any scaling to BR's
     if(ecms_!=7){
-      scale_.clear(); seven2xxxTeV();
-      if(background(proc)){
-	xsec*= scaleBG_[proc];
+      if(background(process)){
+	xsec*= seven2xxxTeV(ecms_, process);
       }
       else{
-	xsec*= linear(mass, scale_);
+	xsec*= linear(mass, seven2xxxTeV(ecms_));
       }
     }
   }
   return xsec;
 }
 
+void
+CrossSection::evaluate(Process process, const std::vector<float>& masses, std::vector<float>& values)
+{
+  check(process);
+  values.resize(masses.size());
+  if(background(process)){
+    // no dependency on the mass
+    std::fill(values.begin(), values.end(), ecms_!=7 ? seven2xxxTeV(ecms_, process) : 1.);
+    return;
+  }
+  // tables are resolved once for all masses
+  const Table& xsec = table(process);
+  const Table* scale = (process != kBR && ecms_!=7) ? &seven2xxxTeV(ecms_) : 0;
+  for(unsigned int idx=0; idx<masses.size(); ++idx){
+    values[idx] = linear(masses[idx], xsec);
+    if(scale){
+      values[idx]*= linear(masses[idx], *scale);
+    }
+  }
+}
+
 float
-CrossSection::linear(float mass, std::map<float, float>& map){
+CrossSection::linear(float mass, const Table& table){
   float value = 0;
-  if(!(mass<map.begin()->first || map.rbegin()->first<mass)){
-    float lowerBound = map.lower_bound(mass)->first == mass ? mass : (--map.lower_bound(mass))->first;
-    float upperBound = map.upper_bound(mass)->first;
-    //std::cout << "mass : " << mass << " - lowerBound : " << lowerBound << " - upperBound : " << upperBound << std::endl;
-
-    if(lowerBound == mass){
-      //std::cout << "mass matches lower bound:" << mass << std::endl;
-      value = map.lower_bound(mass)->second;
+  if(!(mass<table.points[0][0] || table.points[table.size-1][0]<mass)){
+    // bisection for the first point with a mass not smaller than mass
+    unsigned int lower = 0, upper = table.size-1;
+    while(lower<upper){
+      unsigned int middle = (lower+upper)/2;
+      if(table.points[middle][0]<mass){ lower = middle+1; }
+      else{ upper = middle; }
     }
-    else if(upperBound == mass){
-      //std::cout << "mass matches upper bound:" << mass << std::endl;
-      value = map.upper_bound(mass)->second;
+    if(table.points[upper][0] == mass){
+      value = table.points[upper][1];
     }
     else{
       // apply simple linear extrapolation
-      float upperValue = map.upper_bound(mass)->second;
-      float lowerValue = (--map.lower_bound(mass))->second;
-      //std::cout << "interpolate: " << lowerValue << "+" 
-      //	<< (upperValue - lowerValue)*(mass - lowerBound)/(upperBound - lowerBound)
-      //	<< std::endl;
+      float lowerBound = table.points[upper-1][0], lowerValue = table.points[upper-1][1];
+      float upperBound = table.points[upper  ][0], upperValue = table.points[upper  ][1];
       value = lowerValue + (upperValue - lowerValue)*(mass - lowerBound)/(upperBound - lowerBound);
     }
   }
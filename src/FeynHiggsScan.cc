@@ -1,71 +1,332 @@
 #include "HiggsAnalysis/HiggsToTauTau/interface/FeynHiggsScan.h"
 
+#include <algorithm>
+
+#include "TObjArray.h"
+
 FeynHiggsScan::FeynHiggsScan(const char* fileName, const char* treeName, unsigned int n_tanb, double min_tanb, double max_tanb, unsigned int n_mA, double min_mA, double max_mA) :
-  verbose_(false), minTanb_(min_tanb), maxTanb_(max_tanb), stepTanb_((max_tanb-min_tanb)/n_tanb), minMA_(min_mA), maxMA_(max_mA), stepMA_((max_mA-min_mA)/n_mA)
+  verbose_(false), nTanb_(n_tanb), minTanb_(min_tanb), maxTanb_(max_tanb), stepTanb_((max_tanb-min_tanb)/n_tanb), nMA_(n_mA), minMA_(min_mA), maxMA_(max_mA), stepMA_((max_mA-min_mA)/n_mA), file_(0), tree_(0), prefix_(treeName), nodeMA_(0), nodeTanb_(0), regular_(true)
 {
-  // book TH2F for check that filling went OK
-  hscan_    = new TH2F("hscan"    , "hscan"    , n_mA, min_mA, max_mA, n_tanb, min_tanb, max_tanb);
-  // book TH2F for projections
-  hproject_ = new TH2F("hproject" , "hproject" , n_mA, min_mA, max_mA, n_tanb, min_tanb, max_tanb);
-  // open input file
-  file_= TFile::Open(fileName, "read");
-  // get input tree
-  tree_ = (TTree*) file_->Get(treeName);
+  if( FlatGrid::flat(fileName) ){
+    // map flat file; grid points are part of the file
+    if( flat_.open(fileName) ){
+      nodeMA_ = mapped("mA"); nodeTanb_ = mapped("tanb");
+    }
+  }
+  else{
+    // open input file
+    file_= TFile::Open(fileName, "read");
+    // get input tree
+    if( file_ ){
+      tree_ = (TTree*) file_->Get(treeName);
+    }
+  }
+  if( !isOpen() ){
+    std::cout << "ERROR: could not read scan " << treeName << " from file " << fileName << std::endl;
+    // empty grid points, such that all queries return the default values
+    nodeMA_ = mapped("mA"); nodeTanb_ = mapped("tanb");
+  }
 }
 
 FeynHiggsScan::~FeynHiggsScan()
 {
-  delete hscan_;
-  delete hproject_;
-  file_->Close();  
+  if( file_ ){
+    file_->Close();  
+  }
 }
 
-float
-FeynHiggsScan::mass(const std::string& variable, float mA, float tanb)
+int
+FeynHiggsScan::index(float mA, float tanb) const
 {
-  read(variable); 
-  float mass=0.;
+  if( !(minMA_<=mA && mA<maxMA_ && minTanb_<=tanb && tanb<maxTanb_) ){
+    return -1;
+  }
+  // same binning as TAxis::FindFixBin
+  unsigned int iMA   = (unsigned int)(nMA_  *(mA  -minMA_  )/(maxMA_  -minMA_  ));
+  unsigned int iTanb = (unsigned int)(nTanb_*(tanb-minTanb_)/(maxTanb_-minTanb_));
+  if( iMA>=nMA_ || iTanb>=nTanb_ ){
+    return -1;
+  }
+  return iMA*nTanb_+iTanb;
+}
+
+void
+FeynHiggsScan::load(const std::vector<std::string>& variables)
+{
+  if( !tree_ ){
+    // nothing to be read for flat files
+    return;
+  }
+  std::vector<std::string> vars;
+  for(std::vector<std::string>::const_iterator var=variables.begin(); var!=variables.end(); ++var){
+    // the grid points are filled with the first pass in any case
+    if( *var=="mA" || *var=="tanb" || tables_.find(*var)!=tables_.end() || std::find(vars.begin(), vars.end(), *var)!=vars.end() ){
+      continue;
+    }
+    if( !tree_->GetBranch(var->c_str()) ){
+      std::cout << "ERROR: branch " << *var << " not found in tree " << tree_->GetName() << std::endl;
+      // keep an empty grid such that the tree is not searched again
+      grids_[*var].assign(nMA_*nTanb_, 0.);
+      tables_[*var] = &grids_[*var][0];
+      continue;
+    }
+    vars.push_back(*var);
+  }
+  bool nodes = (nodeMA_==0);
+  if( vars.empty() && !nodes ){
+    return;
+  }
+  std::vector<std::vector<float>*> grids;
+  for(std::vector<std::string>::const_iterator var=vars.begin(); var!=vars.end(); ++var){
+    std::vector<float>& values = grids_[*var];
+    values.assign(nMA_*nTanb_, 0.);
+    tables_[*var] = &values[0];
+    grids.push_back(&values);
+  }
+  std::vector<float>* gridMA = 0; std::vector<float>* gridTanb = 0;
+  if( nodes ){
+    gridMA = &grids_["mA"]; gridTanb = &grids_["tanb"];
+    gridMA->assign(nMA_*nTanb_, -1.); gridTanb->assign(nMA_*nTanb_, -1.);
+  }
+  std::vector<float> values(vars.size(), 0.);
+  read(vars, values);
   unsigned int nevent = tree_->GetEntries();
-  if(verbose_){ std::cout << "tree size = " << nevent << std::endl; }
+  if(verbose_){ std::cout << "tree size = " << nevent << " (" << vars.size() << " variables)" << std::endl; }
   for(unsigned int idx=0; idx<nevent; ++idx){
-    tree_->GetEvent(idx);
+    tree_->GetEntry(idx);
     if(verbose_){ std::cout << "tanb = " << tanb_ << "  |  mA = " << mA_ << std::endl; }
-    if(mA_==mA && tanb_==tanb){
-      mass = var_;
-      break;
+    // grid points are filled into the cell right above them (as for the former projection into a
+    // TH2F at mA+step_mA/2, tanb+step_tanb/2)
+    int cell = index(mA_+stepMA_/2., tanb_+stepTanb_/2.);
+    if( cell<0 ){
+      regular_ = false;
+      continue;
+    }
+    for(unsigned int ivar=0; ivar<vars.size(); ++ivar){
+      (*grids[ivar])[cell] += values[ivar];
+    }
+    if( nodes ){
+      if( (*gridMA)[cell]<0 ){
+        (*gridMA)[cell] = mA_; (*gridTanb)[cell] = tanb_;
+      }
+      else{
+        regular_ = false;
+      }
     }
   }
-  return mass;
+  if( nodes ){
+    nodeMA_   = tables_["mA"  ] = &(*gridMA  )[0];
+    nodeTanb_ = tables_["tanb"] = &(*gridTanb)[0];
+    if( !regular_ ){
+      std::cout << "WARNING: tree " << tree_->GetName() << " has more than one entry per grid cell or entries outside the grid; "
+                << "masses are looked up in the tree" << std::endl;
+    }
+  }
+  // values goes out of scope; re-enable all branches for any further use of the tree
+  tree_->ResetBranchAddresses();
+  tree_->SetBranchStatus("*", 1);
 }
 
-TH2F* 
-FeynHiggsScan::project(const std::string& var)
+const float*
+FeynHiggsScan::grid(const std::string& var)
 {
-  read(var); 
-  hscan_->Clear(); hproject_->Clear();
-  unsigned int nevent = tree_->GetEntries();
-  if(verbose_){ std::cout << "tree size = " << nevent << std::endl; }
-  for(unsigned int idx=0; idx<nevent; ++idx){
-    tree_->GetEvent(idx);
-    if(verbose_){ std::cout << "tanb = " << tanb_ << "  |  mA = " << mA_ << std::endl; }
-    hscan_->Fill(mA_+stepMA_/2., tanb_+stepTanb_/2., 1.);
-    hproject_->Fill(mA_+stepMA_/2., tanb_+stepTanb_/2., var_);
+  std::map<std::string, const float*>::const_iterator buffer = tables_.find(var);
+  if( buffer!=tables_.end() ){
+    return buffer->second;
+  }
+  if( !tree_ ){
+    return mapped(var);
+  }
+  load(std::vector<std::string>(1, var));
+  return tables_[var];
+}
+
+const float*
+FeynHiggsScan::mapped(const std::string& var)
+{
+  const FlatGrid::Record* record = flat_.find(prefix_+"/"+var);
+  if( record && record->nx==nMA_ && record->ny==nTanb_ && record->xmin==minMA_ && record->xmax==maxMA_ && record->ymin==minTanb_ && record->ymax==maxTanb_ ){
+    return tables_[var] = flat_.values(*record);
+  }
+  if( record ){
+    std::cout << "ERROR: grid " << prefix_ << "/" << var << " in flat file does not match the scan parameters" << std::endl;
+  }
+  else if( flat_.isOpen() ){
+    std::cout << "ERROR: grid " << prefix_ << "/" << var << " not found in flat file" << std::endl;
+  }
+  // keep an empty grid such that the file is not searched again
+  grids_[var].assign(nMA_*nTanb_, 0.);
+  return tables_[var] = &grids_[var][0];
+}
+
+std::vector<std::string>
+FeynHiggsScan::variables() const
+{
+  std::vector<std::string> vars;
+  if( flat_.isOpen() ){
+    std::vector<std::string> names = flat_.names();
+    for(std::vector<std::string>::const_iterator name=names.begin(); name!=names.end(); ++name){
+      if( name->find(prefix_+"/")==0 ){
+        vars.push_back(name->substr(prefix_.size()+1));
+      }
+    }
+  }
+  else if( tree_ ){
+    TObjArray* branches = tree_->GetListOfBranches();
+    for(int idx=0; idx<branches->GetEntries(); ++idx){
+      vars.push_back(branches->At(idx)->GetName());
+    }
   }
-  return hproject_;
+  vars.erase(std::remove(vars.begin(), vars.end(), std::string("mA"  )), vars.end());
+  vars.erase(std::remove(vars.begin(), vars.end(), std::string("tanb")), vars.end());
+  return vars;
+}
+
+bool
+FeynHiggsScan::flatten(std::vector<FlatGrid::Grid>& grids, const std::string& prefix) const
+{
+  if( !regular_ ){
+    std::cout << "ERROR: scan " << prefix << " has more than one entry per grid cell or entries outside the grid" << std::endl;
+    return false;
+  }
+  for(std::map<std::string, const float*>::const_iterator table=tables_.begin(); table!=tables_.end(); ++table){
+    FlatGrid::Grid grid;
+    grid.name = prefix+"/"+table->first;
+    grid.nx = nMA_; grid.xmin = minMA_; grid.xmax = maxMA_;
+    grid.ny = nTanb_; grid.ymin = minTanb_; grid.ymax = maxTanb_;
+    grid.values.assign(table->second, table->second+nMA_*nTanb_);
+    grids.push_back(grid);
+  }
+  return true;
+}
+
+float
+FeynHiggsScan::mass(const std::string& variable, float mA, float tanb)
+{
+  float mass=0.;
+  const float* values = grid(variable);
+  if( !regular_ ){
+    // the grid holds sums or misses points
+    return scan(variable, mA, tanb);
+  }
+  // masses are only returned for exact grid points
+  int cell = index(mA+stepMA_/2., tanb+stepTanb_/2.);
+  if( cell>=0 && nodeMA_[cell]==mA && nodeTanb_[cell]==tanb ){
+    mass = values[cell];
+  }
+  return mass;
 }
 
 float
 FeynHiggsScan::get(const char* variable, const char* model, const char* type, float mA, float tanb)
 {
   float result = -999.;
-  std::string varname(std::string(type)+"_"+std::string(model)+"_"+std::string(variable));
-  TH2F* hist = project(varname); 
-  if( minMA_<=mA && mA<maxMA_ && minTanb_<=tanb && tanb<maxTanb_){
-    result = hist->GetBinContent(hist->FindBin(mA, tanb));
+  const float* values = grid(name(variable, model, type));
+  int cell = index(mA, tanb);
+  if( cell>=0 ){
+    result = values[cell];
   }
   return result;
 }
 
+void
+FeynHiggsScan::get(const char* variable, const char* model, const char* type, const std::vector<float>& mA, const std::vector<float>& tanb, std::vector<float>& values, bool interpolate)
+{
+  const float* table = grid(name(variable, model, type));
+  if( interpolate && !regular_ ){
+    // cells with more than one entry hold sums, interpolating between them would be meaningless
+    std::cout << "WARNING: tree " << prefix_ << " is not a regular grid, values are not interpolated" << std::endl;
+    interpolate = false;
+  }
+  if( interpolate ){
+    this->interpolate(table, mA, tanb, values, -999.);
+    return;
+  }
+  unsigned int n = std::min(mA.size(), tanb.size());
+  values.resize(n);
+  for(unsigned int idx=0; idx<n; ++idx){
+    int cell = index(mA[idx], tanb[idx]);
+    values[idx] = cell<0 ? -999. : table[cell];
+  }
+}
+
+void
+FeynHiggsScan::mass(const std::string& variable, const std::vector<float>& mA, const std::vector<float>& tanb, std::vector<float>& values, bool interpolate)
+{
+  const float* table = grid(variable);
+  if( interpolate && !regular_ ){
+    // cells with more than one entry hold sums, interpolating between them would be meaningless
+    std::cout << "WARNING: tree " << prefix_ << " is not a regular grid, values are not interpolated" << std::endl;
+    interpolate = false;
+  }
+  if( interpolate ){
+    this->interpolate(table, mA, tanb, values, 0.);
+    return;
+  }
+  unsigned int n = std::min(mA.size(), tanb.size());
+  values.resize(n);
+  for(unsigned int idx=0; idx<n; ++idx){
+    if( !regular_ ){
+      values[idx] = scan(variable, mA[idx], tanb[idx]);
+      continue;
+    }
+    int cell = index(mA[idx]+stepMA_/2., tanb[idx]+stepTanb_/2.);
+    values[idx] = (cell>=0 && nodeMA_[cell]==mA[idx] && nodeTanb_[cell]==tanb[idx]) ? table[cell] : 0.;
+  }
+}
+
+float
+FeynHiggsScan::scan(const std::string& var, float mA, float tanb)
+{
+  float mass=0.;
+  if( !tree_ || !tree_->GetBranch(var.c_str()) ){
+    return mass;
+  }
+  std::vector<std::string> vars(1, var); std::vector<float> values(1, 0.);
+  read(vars, values);
+  unsigned int nevent = tree_->GetEntries();
+  for(unsigned int idx=0; idx<nevent; ++idx){
+    tree_->GetEntry(idx);
+    if( mA_==mA && tanb_==tanb ){
+      mass = values[0];
+      break;
+    }
+  }
+  tree_->ResetBranchAddresses();
+  tree_->SetBranchStatus("*", 1);
+  return mass;
+}
+
+void
+FeynHiggsScan::interpolate(const float* grid, const std::vector<float>& mA, const std::vector<float>& tanb, std::vector<float>& values, float fallback) const
+{
+  unsigned int n = std::min(mA.size(), tanb.size());
+  values.resize(n);
+  // first pass: position of each point in units of the grid steps; kept free of branches and
+  // memory indirection such that the compiler can vectorize it
+  std::vector<float> posMA(n), posTanb(n);
+  float scaleMA = nMA_/(maxMA_-minMA_), scaleTanb = nTanb_/(maxTanb_-minTanb_);
+  for(unsigned int idx=0; idx<n; ++idx){
+    posMA  [idx] = (mA  [idx]-minMA_  )*scaleMA;
+    posTanb[idx] = (tanb[idx]-minTanb_)*scaleTanb;
+  }
+  // second pass: gather the four surrounding grid points and interpolate
+  for(unsigned int idx=0; idx<n; ++idx){
+    if( !(0<=posMA[idx] && posMA[idx]<nMA_ && 0<=posTanb[idx] && posTanb[idx]<nTanb_) ){
+      values[idx] = fallback;
+      continue;
+    }
+    unsigned int iMA = (unsigned int)posMA[idx], iTanb = (unsigned int)posTanb[idx];
+    float fMA = posMA[idx]-iMA, fTanb = posTanb[idx]-iTanb;
+    // at the upper edge of the grid there is no neighbour to interpolate to
+    unsigned int dMA   = iMA+1<nMA_     ? nTanb_ : 0;
+    unsigned int dTanb = iTanb+1<nTanb_ ? 1      : 0;
+    const float* cell = &grid[iMA*nTanb_+iTanb];
+    values[idx] = (1.-fMA)*((1.-fTanb)*cell[0  ]+fTanb*cell[dTanb    ])
+                +     fMA *((1.-fTanb)*cell[dMA]+fTanb*cell[dMA+dTanb]);
+  }
+}
+
 void
 FeynHiggsScan::book(const std::string& var)
 {
@@ -76,10 +337,16 @@ FeynHiggsScan::book(const std::string& var)
 }
 
 void
-FeynHiggsScan::read(const std::string& var)
+FeynHiggsScan::read(const std::vector<std::string>& vars, std::vector<float>& values)
 {
+  // only read the branches that are needed
+  tree_->SetBranchStatus( "*"    , 0 );
+  tree_->SetBranchStatus( "tanb" , 1 );
+  tree_->SetBranchStatus( "mA"   , 1 );
   tree_->SetBranchAddress( "tanb"      , &tanb_ );
   tree_->SetBranchAddress( "mA"        , &mA_   );
-  tree_->SetBranchAddress( var.c_str() , &var_  );
+  for(unsigned int ivar=0; ivar<vars.size(); ++ivar){
+    tree_->SetBranchStatus ( vars[ivar].c_str() , 1 );
+    tree_->SetBranchAddress( vars[ivar].c_str() , &values[ivar] );
+  }
 }
-
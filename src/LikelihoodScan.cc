@@ -245,11 +245,11 @@ PlotLimits::plot1DScan(TCanvas& canv, const char* directory)
     //band1D(scanOut, xval, yval, bestfit, graph68, (xmax-xmin)/nbins/2, (ymax-ymin)/nbins/2, "(68%)");
 
     if(png_){
-      canv.Print(TString::Format("%s-%s-%d.png", output_.c_str(), label_.c_str(), (int)mass));
+      printCanvas(canv, TString::Format("%s-%s-%d.png", output_.c_str(), label_.c_str(), (int)mass));
     }
     if(pdf_){
-      canv.Print(TString::Format("%s-%s-%d.pdf", output_.c_str(), label_.c_str(), (int)mass));
-      canv.Print(TString::Format("%s-%s-%d.eps", output_.c_str(), label_.c_str(), (int)mass));
+      printCanvas(canv, TString::Format("%s-%s-%d.pdf", output_.c_str(), label_.c_str(), (int)mass));
+      printCanvas(canv, TString::Format("%s-%s-%d.eps", output_.c_str(), label_.c_str(), (int)mass));
     }
     if(txt_){
       TString path;
@@ -259,14 +259,9 @@ PlotLimits::plot1DScan(TCanvas& canv, const char* directory)
       //print(path, xval, yval, graph95, "txt"); print(path, xval, yval, graph95, "tex");
     }
     if(root_){
-      TFile* output = new TFile("likelihood-scan.root", "update");
-      if(!output->cd(output_.c_str())){
-	output->mkdir(output_.c_str());
-	output->cd(output_.c_str());
-      }
-      if(bestfit){ bestfit->Write(TString::Format("bestfit_%d", (int)mass)); }
-      scan1D->Write(TString::Format("plot1D_%d", (int)mass));
-      output->Close();
+      std::string output("likelihood-scan.root");
+      if(bestfit){ OutputWriter::instance().write(output, output_, bestfit, TString::Format("bestfit_%d", (int)mass)); }
+      OutputWriter::instance().write(output, output_, scan1D, TString::Format("plot1D_%d", (int)mass));
     }
   }
   return;
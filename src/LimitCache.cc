@@ -0,0 +1,469 @@
+#include <string.h>
+#include <stdlib.h>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+#include "TSystem.h"
+#include "TThread.h"
+#include "HiggsAnalysis/HiggsToTauTau/interface/Profile.h"
+#include "HiggsAnalysis/HiggsToTauTau/interface/LimitCache.h"
+
+/// files to be read by a single thread in LimitCache::prefetch
+struct LimitCacheJob {
+  /// cache to read with
+  const LimitCache* cache;
+  /// pairs of file path and entry to be filled
+  std::vector<std::pair<std::string, LimitCache::Entry*> > todo;
+  /// tree and branch names
+  const char* treename; const char* branchname; const char* quantilename;
+};
+
+std::string
+LimitCache::key(const char* fullpath, const char* treename, const char* branchname, const char* quantilename) const
+{
+  return std::string(fullpath)+":"+treename+":"+branchname+":"+(quantilename ? quantilename : "");
+}
+
+const LimitCache::Entry&
+LimitCache::get(const char* fullpath, const char* treename, const char* branchname, const char* quantilename)
+{
+  std::map<std::string, Entry>::iterator entry = cache_.find(key(fullpath, treename, branchname, quantilename));
+  if(entry==cache_.end()){
+    entry = cache_.insert(std::make_pair(key(fullpath, treename, branchname, quantilename), Entry())).first;
+    read(entry->second, fullpath, treename, branchname, quantilename); ++opened_;
+  }
+  return entry->second;
+}
+
+bool
+LimitCache::stream(const char* fullpath, Sink sink, void* data, const char* treename, const char* branchname)
+{
+  // the entry only records the state of the file, the values are passed on to sink
+  Entry& entry = cache_[key(fullpath, treename, branchname, 0)+":stream"];
+  entry.valid = false;
+  entry.fullpath = fullpath;
+  entry.values.clear(); entry.quantiles.clear();
+  stat(fullpath, entry.mtime, entry.size);
+  if(verbosity_>1) std::cout << "INFO: opening file " << fullpath << std::endl;
+  TFile* file = 0;
+  {
+    Profile::Timer timer("LimitCache: open file");
+    file = new TFile(fullpath); ++opened_;
+  }
+  if(file->IsZombie()){
+    if(verbosity_>0){ std::cout << "INFO: file not found: " << fullpath  << std::endl; }
+  }
+  else{
+    TTree* limit = (TTree*) file->Get(treename);
+    if(!limit){
+      if(verbosity_>0){ std::cout << "INFO: tree not found: " << treename << std::endl; }
+    }
+    else if(!limit->GetBranch(branchname)){
+      if(verbosity_>0){ std::cout << "INFO: branch not found: " << branchname << std::endl; }
+    }
+    else{
+      Profile::Timer timer("LimitCache: stream tree");
+      double x;
+      // only read what is needed
+      limit->SetBranchStatus("*", 0);
+      limit->SetBranchStatus(branchname, 1);
+      limit->SetBranchAddress(branchname, &x);
+      int nevent = limit->GetEntries();
+      for(int i=0; i<nevent; ++i){
+	limit->GetEntry(i);
+	sink(x, data);
+      }
+      timer.count(nevent);
+      entry.valid = true;
+    }
+    file->Close();
+  }
+  delete file;
+  return entry.valid;
+}
+
+void
+LimitCache::prefetch(const std::vector<std::string>& fullpaths, unsigned int nthreads, const char* treename, const char* branchname, const char* quantilename)
+{
+  if(nthreads<2){
+    // nothing to gain, files will be read on request
+    return;
+  }
+  // entries are created here, such that the threads never modify the map itself
+  std::vector<LimitCacheJob> jobs(nthreads);
+  for(unsigned int ijob=0; ijob<jobs.size(); ++ijob){
+    jobs[ijob].cache=this; jobs[ijob].treename=treename; jobs[ijob].branchname=branchname; jobs[ijob].quantilename=quantilename;
+  }
+  unsigned int nfiles=0;
+  for(std::vector<std::string>::const_iterator path=fullpaths.begin(); path!=fullpaths.end(); ++path){
+    std::string buffer = key(path->c_str(), treename, branchname, quantilename);
+    if(cache_.find(buffer)==cache_.end()){
+      Entry* entry = &(cache_.insert(std::make_pair(buffer, Entry())).first->second);
+      jobs[nfiles++%nthreads].todo.push_back(std::make_pair(*path, entry));
+    }
+  }
+  if(nfiles==0){
+    return;
+  }
+  TThread::Initialize();
+  std::vector<TThread*> threads;
+  for(unsigned int ijob=0; ijob<jobs.size(); ++ijob){
+    if(jobs[ijob].todo.empty()){
+      continue;
+    }
+    threads.push_back(new TThread(TString::Format("LimitCache%d", ijob), &LimitCache::worker, &jobs[ijob]));
+    threads.back()->Run();
+  }
+  for(std::vector<TThread*>::iterator thread=threads.begin(); thread!=threads.end(); ++thread){
+    (*thread)->Join(); delete *thread;
+  }
+  opened_+=nfiles;
+}
+
+void*
+LimitCache::worker(void* job)
+{
+  LimitCacheJob* buffer = (LimitCacheJob*)job;
+  for(std::vector<std::pair<std::string, Entry*> >::const_iterator file=buffer->todo.begin(); file!=buffer->todo.end(); ++file){
+    buffer->cache->read(*(file->second), file->first.c_str(), buffer->treename, buffer->branchname, buffer->quantilename);
+  }
+  return 0;
+}
+
+void
+LimitCache::read(Entry& entry, const char* fullpath, const char* treename, const char* branchname, const char* quantilename) const
+{
+  entry.valid = false;
+  entry.fullpath = fullpath;
+  // record the state of the file before reading, such that changes while reading are caught
+  stat(fullpath, entry.mtime, entry.size);
+  if(verbosity_>1) std::cout << "INFO: opening file " << fullpath << std::endl;
+  TFile* file = 0;
+  {
+    Profile::Timer timer("LimitCache: open file");
+    file = new TFile(fullpath);
+  }
+  if(file->IsZombie()){
+    if(verbosity_>0){ std::cout << "INFO: file not found: " << fullpath  << std::endl; }
+  }
+  else{
+    TTree* limit = (TTree*) file->Get(treename);
+    if(!limit){
+      if(verbosity_>0){ std::cout << "INFO: tree not found: " << treename << std::endl; }
+    }
+    else if(!limit->GetBranch(branchname)){
+      if(verbosity_>0){ std::cout << "INFO: branch not found: " << branchname << std::endl; }
+    }
+    else{
+      Profile::Timer timer("LimitCache: read tree");
+      double x; float y;
+      bool quantiles = quantilename && limit->GetBranch(quantilename);
+      // only read what is needed
+      limit->SetBranchStatus("*", 0);
+      limit->SetBranchStatus(branchname, 1);
+      limit->SetBranchAddress(branchname, &x);
+      if(quantiles){
+	limit->SetBranchStatus(quantilename, 1);
+	limit->SetBranchAddress(quantilename, &y);
+      }
+      int nevent = limit->GetEntries();
+      entry.values.reserve(nevent);
+      if(quantiles){ entry.quantiles.reserve(nevent); }
+      for(int i=0; i<nevent; ++i){
+	limit->GetEntry(i);
+	entry.values.push_back(x);
+	if(quantiles){ entry.quantiles.push_back(y); }
+      }
+      timer.count(nevent);
+      entry.valid = true;
+    }
+    file->Close();
+  }
+  delete file;
+}
+
+/// name of the harvested file in the limit directory
+static const char* HARVESTED = "harvested-limits.root";
+
+unsigned int
+LimitCache::harvest(const char* directory, unsigned int nthreads)
+{
+  // collect all mass directories, sorted by mass
+  std::vector<int> masses;
+  void* dir = gSystem->OpenDirectory(directory);
+  if(!dir){
+    std::cout << "ERROR: directory not found: " << directory << std::endl;
+    return 0;
+  }
+  const char* buffer;
+  while((buffer = gSystem->GetDirEntry(dir))){
+    std::string subdir(buffer);
+    if(!subdir.empty() && subdir.find_first_not_of("0123456789")==std::string::npos){
+      masses.push_back(atoi(subdir.c_str()));
+    }
+  }
+  gSystem->FreeDirectory(dir);
+  std::sort(masses.begin(), masses.end());
+  // collect all combine output files of each mass directory and split up their names
+  // as higgsCombine[name].[method].mH[mass][suffix].root
+  std::vector<int> mass;
+  std::vector<std::string> fullpaths, names, methods, suffixes;
+  for(std::vector<int>::const_iterator m=masses.begin(); m!=masses.end(); ++m){
+    std::vector<std::string> files;
+    void* massdir = gSystem->OpenDirectory(TString::Format("%s/%d", directory, *m));
+    if(!massdir){
+      continue;
+    }
+    while((buffer = gSystem->GetDirEntry(massdir))){
+      std::string file(buffer);
+      if(file.find("higgsCombine")==0 && file.size()>5 && file.rfind(".root")==file.size()-5){
+	files.push_back(file);
+      }
+    }
+    gSystem->FreeDirectory(massdir);
+    std::sort(files.begin(), files.end());
+    for(std::vector<std::string>::const_iterator file=files.begin(); file!=files.end(); ++file){
+      std::string stem = file->substr(12, file->size()-17);
+      std::string tag  = std::string(TString::Format(".mH%d", *m).Data());
+      if(stem.find('.')==std::string::npos || stem.find(tag)==std::string::npos || stem.find(tag)<stem.find('.')){
+	if(verbosity_>0){ std::cout << "INFO: skipping file: " << *file << std::endl; }
+	continue;
+      }
+      std::string suffix = stem.substr(stem.find(tag)+tag.size());
+      if(!suffix.empty() && suffix[0]!='.'){
+	// mass of the file does not match mass of the directory (e.g. mH125 for mH1250)
+	if(verbosity_>0){ std::cout << "INFO: skipping file: " << *file << std::endl; }
+	continue;
+      }
+      mass    .push_back(*m);
+      names   .push_back(stem.substr(0, stem.find('.')));
+      methods .push_back(stem.substr(stem.find('.')+1, stem.find(tag)-stem.find('.')-1));
+      suffixes.push_back(suffix);
+      fullpaths.push_back(TString::Format("%s/%d/%s", directory, *m, file->c_str()).Data());
+    }
+  }
+  prefetch(fullpaths, nthreads);
+  // write everything into a single flat tree
+  TString output = TString::Format("%s/%s", directory, HARVESTED);
+  TFile* file = new TFile(output, "recreate");
+  if(file->IsZombie()){
+    std::cout << "ERROR: could not create file: " << output << std::endl;
+    delete file;
+    return 0;
+  }
+  float m, quantile; double limit; Long64_t mtime, size;
+  char name[256], method[256], suffix[256];
+  TTree* limits = new TTree("limits", "harvested combine limits");
+  limits->Branch("mass"    , &m       , "mass/F"    );
+  limits->Branch("name"    , name     , "name/C"    );
+  limits->Branch("method"  , method   , "method/C"  );
+  limits->Branch("suffix"  , suffix   , "suffix/C"  );
+  limits->Branch("quantile", &quantile, "quantile/F");
+  limits->Branch("limit"   , &limit   , "limit/D"   );
+  limits->Branch("mtime"   , &mtime   , "mtime/L"   );
+  limits->Branch("size"    , &size    , "size/L"    );
+  unsigned int nfiles=0;
+  for(unsigned int ifile=0; ifile<fullpaths.size(); ++ifile){
+    const Entry& entry = get(fullpaths[ifile].c_str());
+    if(!entry.valid){
+      continue;
+    }
+    m = mass[ifile];
+    strncpy(name  , names   [ifile].c_str(), sizeof(name  )-1); name  [sizeof(name  )-1]=0;
+    strncpy(method, methods [ifile].c_str(), sizeof(method)-1); method[sizeof(method)-1]=0;
+    strncpy(suffix, suffixes[ifile].c_str(), sizeof(suffix)-1); suffix[sizeof(suffix)-1]=0;
+    // state of the file when it was read, such that readers can detect outdated rows
+    mtime = entry.mtime; size = entry.size;
+    for(unsigned int i=0; i<entry.values.size(); ++i){
+      quantile = i<entry.quantiles.size() ? entry.quantiles[i] : -999.;
+      limit = entry.values[i];
+      limits->Fill();
+    }
+    ++nfiles;
+  }
+  file->cd();
+  limits->Write();
+  file->Close();
+  delete file;
+  if(verbosity_>0){ std::cout << "INFO: harvested " << nfiles << " files into " << output << std::endl; }
+  return nfiles;
+}
+
+bool
+LimitCache::load(const char* directory)
+{
+  if(!loaded_.insert(directory).second){
+    // directory has been tried before
+    return false;
+  }
+  TString input = TString::Format("%s/%s", directory, HARVESTED);
+  if(gSystem->AccessPathName(input)){
+    // file does not exist
+    return false;
+  }
+  if(verbosity_>1) std::cout << "INFO: opening file " << input << std::endl;
+  Profile::Timer timer("LimitCache: load harvested file");
+  TFile* file = new TFile(input); ++opened_;
+  TTree* limits = file->IsZombie() ? 0 : (TTree*) file->Get("limits");
+  if(!limits){
+    if(verbosity_>0){ std::cout << "INFO: tree not found: limits" << std::endl; }
+    file->Close(); delete file;
+    return false;
+  }
+  if(!limits->GetBranch("mtime") || !limits->GetBranch("size")){
+    // without the state of the files there is no way to tell outdated rows
+    std::cout << "WARNING: " << input << " has no modification times; please harvest again" << std::endl;
+    file->Close(); delete file;
+    return false;
+  }
+  float m, quantile; double limit; Long64_t mtime, size;
+  char name[256], method[256], suffix[256];
+  limits->SetBranchAddress("mass"    , &m       );
+  limits->SetBranchAddress("name"    , name     );
+  limits->SetBranchAddress("method"  , method   );
+  limits->SetBranchAddress("suffix"  , suffix   );
+  limits->SetBranchAddress("quantile", &quantile);
+  limits->SetBranchAddress("limit"   , &limit   );
+  limits->SetBranchAddress("mtime"   , &mtime   );
+  limits->SetBranchAddress("size"    , &size    );
+  // collect all entries first, files which are already buffered are not touched. Rows of
+  // files that changed since they were harvested are skipped; these files are read from
+  // the mass directory on request
+  std::map<std::string, Entry> harvested;
+  Entry* entry=0; std::string last; bool outdated=false; unsigned int nchanged=0;
+  int nevent = limits->GetEntries();
+  for(int i=0; i<nevent; ++i){
+    limits->GetEntry(i);
+    std::string fullpath(TString::Format("%s/%d/higgsCombine%s.%s.mH%d%s.root", directory, (int)m, name, method, (int)m, suffix).Data());
+    if(fullpath!=last){
+      last = fullpath;
+      Long_t current; Long64_t bytes;
+      stat(fullpath.c_str(), current, bytes);
+      outdated = (current!=(Long_t)mtime || bytes!=size);
+      if(outdated){
+	if(verbosity_>0){ std::cout << "INFO: file changed since harvest: " << fullpath << std::endl; }
+	++nchanged;
+	continue;
+      }
+      entry = &harvested[key(fullpath.c_str(), "limit", "limit", "quantileExpected")];
+      entry->valid = true;
+      entry->fullpath = fullpath;
+      entry->mtime = current; entry->size = bytes;
+    }
+    if(outdated){
+      continue;
+    }
+    entry->quantiles.push_back(quantile);
+    entry->values.push_back(limit);
+  }
+  timer.count(nevent);
+  file->Close();
+  delete file;
+  cache_.insert(harvested.begin(), harvested.end());
+  if(verbosity_>0){ std::cout << "INFO: loaded " << harvested.size() << " harvested files from " << input << " (" << nchanged << " changed since harvest)" << std::endl; }
+  return true;
+}
+
+bool
+LimitCache::stat(const char* fullpath, Long_t& mtime, Long64_t& size)
+{
+  Long_t id, flags;
+  if(gSystem->GetPathInfo(fullpath, &id, &size, &flags, &mtime)!=0){
+    mtime=0; size=-1;
+    return false;
+  }
+  return true;
+}
+
+unsigned int
+LimitCache::update()
+{
+  unsigned int nfiles=0;
+  std::map<std::string, Entry>::iterator entry=cache_.begin();
+  while(entry!=cache_.end()){
+    Long_t mtime; Long64_t size;
+    stat(entry->second.fullpath.c_str(), mtime, size);
+    if(mtime!=entry->second.mtime || size!=entry->second.size){
+      if(verbosity_>0){ std::cout << "INFO: file changed: " << entry->second.fullpath << std::endl; }
+      cache_.erase(entry++); ++nfiles;
+    }
+    else{
+      ++entry;
+    }
+  }
+  // the harvested file is not loaded again: rows of changed files are outdated, the
+  // dropped files are read from the mass directory on next request
+  return nfiles;
+}
+
+bool
+LimitCache::save(const char* filename, const std::string& tag) const
+{
+  std::ofstream file(filename);
+  if(!file){
+    std::cout << "ERROR: could not create file: " << filename << std::endl;
+    return false;
+  }
+  // one line per buffered file: key and path (each followed by a tab, such that they may contain
+  // spaces), mtime, size, valid, number of quantiles and values followed by the quantiles and
+  // values themselves
+  file << "# " << tag << std::endl;
+  for(std::map<std::string, Entry>::const_iterator entry=cache_.begin(); entry!=cache_.end(); ++entry){
+    if(entry->first.find_first_of("\t\n")!=std::string::npos){
+      // cannot be stored, the file will be read again by the next process
+      std::cout << "WARNING: path with tab or newline not written to manifest: " << entry->second.fullpath << std::endl;
+      continue;
+    }
+    file << entry->first << "\t" << entry->second.fullpath << "\t" << entry->second.mtime << " " << entry->second.size << " " << entry->second.valid
+	 << " " << entry->second.quantiles.size() << " " << entry->second.values.size();
+    for(std::vector<float>::const_iterator q=entry->second.quantiles.begin(); q!=entry->second.quantiles.end(); ++q){
+      file << " " << std::setprecision(9) << *q;
+    }
+    for(std::vector<double>::const_iterator v=entry->second.values.begin(); v!=entry->second.values.end(); ++v){
+      file << " " << std::setprecision(17) << *v;
+    }
+    file << std::endl;
+  }
+  return true;
+}
+
+int
+LimitCache::restore(const char* filename, std::string* tag)
+{
+  std::ifstream file(filename);
+  if(!file){
+    return -1;
+  }
+  std::string line;
+  if(!std::getline(file, line) || line.find("# ")!=0){
+    std::cout << "ERROR: not a manifest file: " << filename << std::endl;
+    return -1;
+  }
+  if(tag){ *tag = line.substr(2); }
+  int nfiles=0;
+  while(std::getline(file, line)){
+    std::string buffer; Entry entry; unsigned int nquantiles, nvalues;
+    std::stringstream stream(line);
+    std::getline(stream, buffer, '\t'); std::getline(stream, entry.fullpath, '\t');
+    stream >> entry.mtime >> entry.size >> entry.valid >> nquantiles >> nvalues;
+    entry.quantiles.resize(nquantiles); entry.values.resize(nvalues);
+    for(unsigned int i=0; i<nquantiles; ++i){ stream >> entry.quantiles[i]; }
+    for(unsigned int i=0; i<nvalues   ; ++i){ stream >> entry.values   [i]; }
+    if(stream.fail()){
+      std::cout << "ERROR: malformed line in manifest file: " << filename << std::endl;
+      return -1;
+    }
+    Long_t mtime; Long64_t size;
+    stat(entry.fullpath.c_str(), mtime, size);
+    if(mtime!=entry.mtime || size!=entry.size){
+      if(verbosity_>0){ std::cout << "INFO: file changed: " << entry.fullpath << std::endl; }
+      ++nfiles;
+      continue;
+    }
+    // content that has been read already is not overwritten
+    cache_.insert(std::make_pair(buffer, entry));
+  }
+  return nfiles;
+}
@@ -49,11 +49,11 @@ PlotLimits::plotMassEstimate(TCanvas& canv, TGraphAsymmErrors* innerBand, TGraph
   //CMSPrelim(dataset_.c_str(), "", 0.145, 0.835);
   // write to file  
   if(png_){
-    canv.Print(TString::Format("%s-%s.png", output_.c_str(), label_.c_str()));
+    printCanvas(canv, TString::Format("%s-%s.png", output_.c_str(), label_.c_str()));
   }
   if(pdf_){
-    canv.Print(TString::Format("%s-%s.pdf", output_.c_str(), label_.c_str()));
-    canv.Print(TString::Format("%s-%s.eps", output_.c_str(), label_.c_str()));
+    printCanvas(canv, TString::Format("%s-%s.pdf", output_.c_str(), label_.c_str()));
+    printCanvas(canv, TString::Format("%s-%s.eps", output_.c_str(), label_.c_str()));
   }
   if(txt_){
     TString path;
@@ -62,13 +62,8 @@ PlotLimits::plotMassEstimate(TCanvas& canv, TGraphAsymmErrors* innerBand, TGraph
     print(path, modifiedobs, modifiedobs, "tex"); 
   }
   if(root_){
-    TFile* output = new TFile("likelihood-mass-scan.root", "update");
-    if(!output->cd(output_.c_str())){
-	output->mkdir(output_.c_str());
-	output->cd(output_.c_str());
-    }
-    modifiedobs->Write("mass_scan");
-    output->Close();
+    std::string output("likelihood-mass-scan.root");
+    OutputWriter::instance().write(output, output_, modifiedobs, "mass_scan");
   }
   return;
 }
@@ -187,39 +187,61 @@ PlotLimits::plot2DScan(TCanvas& canv, const char* directory)
     TString fullpath = TString::Format("%s/%d/higgsCombine%s.MultiDimFit.mH%d.root", directory, (int)mass, label, (int)mass);
     std::cout << "open file: " << fullpath << std::endl;
 
-    TFile* file_ = TFile::Open(fullpath); if(!file_){ std::cout << "--> TFile is corrupt: skipping masspoint." << std::endl; continue; }
-    TTree* limit = (TTree*) file_->Get("limit"); if(!limit){ std::cout << "--> TTree is corrupt: skipping masspoint." << std::endl; continue; }
-    float nll, x, y;
     float nbins = TMath::Sqrt(points);
-    TH2F* scan2D = new TH2F("scan2D", "", nbins, xmin, xmax, nbins, ymin, ymax);
-    limit->SetBranchAddress("deltaNLL", &nll );  
-    limit->SetBranchAddress((CVCF || RVRF || CBCTAU || CLCQ) ? xval.c_str() : (std::string("r_")+xval).c_str() , &x);  
-    limit->SetBranchAddress((CVCF || RVRF || CBCTAU || CLCQ) ? yval.c_str() : (std::string("r_")+yval).c_str() , &y);
-    int nevent = limit->GetEntries();
-    for(int i=0; i<nevent; ++i){
-      limit->GetEvent(i);
-      if(scan2D->GetBinContent(scan2D->FindBin(x,y))==0){
-	// catch small negative values that might occure due to rounding
-	scan2D->Fill(x, y, fabs(nll));
-      }
-    }
-    // determine bestfit graph
+    TH2F* scan2D = 0;
+    // scan points and the bin of each of them (the same for scan2D and plot2D)
+    int nevent = 0;
+    std::vector<float> nlls, xs, ys;
+    std::vector<int> bins;
     float bestFit=-1.; 
     float buffer=0., bestX=-999., bestY=-999.;
-    for(int i=0; i<nevent; ++i){
-      limit->GetEvent(i);
-      buffer=scan2D->GetBinContent(scan2D->FindBin(x,y));
-      if (bestFit<0 || bestFit>buffer){
-	//std::cout << "update bestFit coordinates: " << std::endl;
-	//std::cout << "-->old: x=" << bestX << " y=" << bestY << " value=" << bestFit << std::endl;
-	// adjust best fit to granularity of scan; we do this to prevent artefacts 
-	// when quoting the 1d uncertainties of the scan. For the plotting this 
-	// does not play a role. 
-	bestX=scan2D->GetXaxis()->GetBinCenter(scan2D->GetXaxis()->FindBin(x)); 
-	bestY=scan2D->GetYaxis()->GetBinCenter(scan2D->GetYaxis()->FindBin(y));
-	bestFit=buffer; 
-	//std::cout << "-->new: x=" << bestX << " y=" << bestY << " value=" << bestFit << std::endl;
+    {
+      Profile::Timer timer("plot2DScan: read scan");
+      TFile* file_ = TFile::Open(fullpath); if(!file_){ std::cout << "--> TFile is corrupt: skipping masspoint." << std::endl; continue; }
+      TTree* limit = (TTree*) file_->Get("limit"); if(!limit){ std::cout << "--> TTree is corrupt: skipping masspoint." << std::endl; continue; }
+      float nll, x, y;
+      scan2D = new TH2F("scan2D", "", nbins, xmin, xmax, nbins, ymin, ymax);
+      std::string xbranch = (CVCF || RVRF || CBCTAU || CLCQ) ? xval : std::string("r_")+xval;
+      std::string ybranch = (CVCF || RVRF || CBCTAU || CLCQ) ? yval : std::string("r_")+yval;
+      // only read what is needed; the tree is read once into arrays, from which the
+      // scan, the best fit and the temperature plot are derived
+      limit->SetBranchStatus("*", 0);
+      limit->SetBranchStatus("deltaNLL", 1);
+      limit->SetBranchStatus(xbranch.c_str(), 1);
+      limit->SetBranchStatus(ybranch.c_str(), 1);
+      limit->SetBranchAddress("deltaNLL", &nll );  
+      limit->SetBranchAddress(xbranch.c_str(), &x);  
+      limit->SetBranchAddress(ybranch.c_str(), &y);
+      nevent = limit->GetEntries();
+      nlls.resize(nevent); xs.resize(nevent); ys.resize(nevent);
+      for(int i=0; i<nevent; ++i){
+	limit->GetEntry(i);
+	nlls[i]=nll; xs[i]=x; ys[i]=y;
+      }
+      bins.resize(nevent);
+      for(int i=0; i<nevent; ++i){
+	bins[i] = scan2D->FindBin(xs[i],ys[i]);
+	if(scan2D->GetBinContent(bins[i])==0){
+	  // catch small negative values that might occure due to rounding
+	  scan2D->Fill(xs[i], ys[i], fabs(nlls[i]));
+	}
+      }
+      // determine bestfit graph
+      for(int i=0; i<nevent; ++i){
+	buffer=scan2D->GetBinContent(bins[i]);
+	if (bestFit<0 || bestFit>buffer){
+	  //std::cout << "update bestFit coordinates: " << std::endl;
+	  //std::cout << "-->old: x=" << bestX << " y=" << bestY << " value=" << bestFit << std::endl;
+	  // adjust best fit to granularity of scan; we do this to prevent artefacts 
+	  // when quoting the 1d uncertainties of the scan. For the plotting this 
+	  // does not play a role. 
+	  bestX=scan2D->GetXaxis()->GetBinCenter(scan2D->GetXaxis()->FindBin(xs[i])); 
+	  bestY=scan2D->GetYaxis()->GetBinCenter(scan2D->GetYaxis()->FindBin(ys[i]));
+	  bestFit=buffer; 
+	  //std::cout << "-->new: x=" << bestX << " y=" << bestY << " value=" << bestFit << std::endl;
+	}
       }
+      timer.count(nevent);
     }
     if(verbosity_>0){
       std::cout << "Bestfit value from likelihood-scan:" << std::endl;
@@ -228,39 +250,42 @@ PlotLimits::plot2DScan(TCanvas& canv, const char* directory)
     TGraph* bestfit = new TGraph();
     bestfit->SetPoint(0, bestX, bestY);
     // determine new contours for 68% CL and 95% CL limits
-    double contours[2];
-    contours[0] = TMath::ChisquareQuantile(0.68,2)/2; //0.5;     //68% CL
-    contours[1] = TMath::ChisquareQuantile(0.95,2)/2; //1.92;    //95% CL
-    scan2D->SetContour(2, contours);
-    scan2D->Draw("CONT Z LIST");  // draw contours as filled regions, and save points
-    canv.Update();                // needed to force the plotting and retrieve the contours in TGraph
-    TObjArray* conts = (TObjArray*)gROOT->GetListOfSpecials()->FindObject("contours");
-
     std::vector<TGraph*> graph68; std::vector<TGraph*> filled68;
     std::vector<TGraph*> graph95; std::vector<TGraph*> filled95;
-    // get 68% CL and 95% CL contours 
-    for(int i=0; i<conts->GetEntries(); ++i){   
-      TList* graphlist = (TList*)conts->At(i);  
-      for(int g=0; g<graphlist->GetEntries(); ++g){
-	if(((TGraph*)graphlist->At(g))->GetN()<5){
-	  continue;
-	}
-	if(i==0){
-	  graph68.push_back((TGraph*)graphlist->At(g));
-	  graph68.back()->SetName(TString::Format("graph68_%d_%d"  , (int)mass , g));
-	  filled68.push_back(convexGraph(graph68.back(), bestX, bestY, xmin, xmax, ymin, ymax, (xmax-xmin)/nbins, true));
-	}
-	if(i==1){
-	  graph95.push_back((TGraph*)graphlist->At(g)); 
-	  graph95.back()->SetName(TString::Format("graph95_%d_%d"  , (int)mass , g));
-	  //filled95.push_back(convexGraph(graph95.back(), xmin, xmax, ymin, ymax, (xmax-xmin)/nbins, g>0));
-	  filled95.push_back(convexGraph(graph95.back(), bestX, bestY, xmin, xmax, ymin, ymax, (xmax-xmin)/nbins, true));
-	}
-	// let's hope that lower left corner also has a graph with index 2
-	// that can be used for plotting
-	//std::cout << "contour: " << i << " -- graph: " << g << std::endl;
-      }
-    }    
+    {
+      Profile::Timer timer("plot2DScan: build contours");
+      double contours[2];
+      contours[0] = TMath::ChisquareQuantile(0.68,2)/2; //0.5;     //68% CL
+      contours[1] = TMath::ChisquareQuantile(0.95,2)/2; //1.92;    //95% CL
+      scan2D->SetContour(2, contours);
+      scan2D->Draw("CONT Z LIST");  // draw contours as filled regions, and save points
+      canv.Update();                // needed to force the plotting and retrieve the contours in TGraph
+      TObjArray* conts = (TObjArray*)gROOT->GetListOfSpecials()->FindObject("contours");
+
+      // get 68% CL and 95% CL contours 
+      for(int i=0; i<conts->GetEntries(); ++i){   
+        TList* graphlist = (TList*)conts->At(i);  
+        for(int g=0; g<graphlist->GetEntries(); ++g){
+	  if(((TGraph*)graphlist->At(g))->GetN()<5){
+	    continue;
+	  }
+	  if(i==0){
+	    graph68.push_back((TGraph*)graphlist->At(g));
+	    graph68.back()->SetName(TString::Format("graph68_%d_%d"  , (int)mass , g));
+	    filled68.push_back(convexGraph(graph68.back(), bestX, bestY, xmin, xmax, ymin, ymax, (xmax-xmin)/nbins, true));
+	  }
+	  if(i==1){
+	    graph95.push_back((TGraph*)graphlist->At(g)); 
+	    graph95.back()->SetName(TString::Format("graph95_%d_%d"  , (int)mass , g));
+	    //filled95.push_back(convexGraph(graph95.back(), xmin, xmax, ymin, ymax, (xmax-xmin)/nbins, g>0));
+	    filled95.push_back(convexGraph(graph95.back(), bestX, bestY, xmin, xmax, ymin, ymax, (xmax-xmin)/nbins, true));
+	  }
+	  // let's hope that lower left corner also has a graph with index 2
+	  // that can be used for plotting
+	  //std::cout << "contour: " << i << " -- graph: " << g << std::endl;
+        }
+      }    
+    }
     
     //for(std::vector<TGraph*>::const_reverse_iterator graph=filled95.rbegin(); graph!=filled95.rend(); ++graph){
     //  std::cout << "-------------- GRAPH (filled) -------------------" << std::endl;
@@ -281,8 +306,7 @@ PlotLimits::plot2DScan(TCanvas& canv, const char* directory)
     TH2F* plot2D = new TH2F("plot2D", "", nbins, xmin, xmax, nbins, ymin, ymax);
     if(temp_){
       for(int i=0; i<nevent; ++i){
-	limit->GetEvent(i);
-	if(plot2D->GetBinContent(plot2D->FindBin(x,y))==0){plot2D->Fill(x, y, nll);}
+	if(plot2D->GetBinContent(bins[i])==0){plot2D->Fill(xs[i], ys[i], nlls[i]);}
       }
     }
     // do the plotting
@@ -304,12 +328,12 @@ PlotLimits::plot2DScan(TCanvas& canv, const char* directory)
     band1D(scanOut, xval, yval, bestfit, graph68.back(), (xmax-xmin)/nbins/2, (ymax-ymin)/nbins/2, "(68%)");
 
     if(png_){
-      canv.Print(TString::Format("%s-%s-%s-%d.png", output_.c_str(), label_.c_str(), model_.c_str(), (int)mass));
+      printCanvas(canv, TString::Format("%s-%s-%s-%d.png", output_.c_str(), label_.c_str(), model_.c_str(), (int)mass));
     }
     if(pdf_){
-      canv.Print(TString::Format("%s-%s-%s-%d.pdf", output_.c_str(), label_.c_str(), model_.c_str(), (int)mass));
-      canv.Print(TString::Format("%s-%s-%s-%d.eps", output_.c_str(), label_.c_str(), model_.c_str(), (int)mass));
-      canv.Print(TString::Format("%s-%s-%s-%d.C"  , output_.c_str(), label_.c_str(), model_.c_str(), (int)mass));
+      printCanvas(canv, TString::Format("%s-%s-%s-%d.pdf", output_.c_str(), label_.c_str(), model_.c_str(), (int)mass));
+      printCanvas(canv, TString::Format("%s-%s-%s-%d.eps", output_.c_str(), label_.c_str(), model_.c_str(), (int)mass));
+      printCanvas(canv, TString::Format("%s-%s-%s-%d.C"  , output_.c_str(), label_.c_str(), model_.c_str(), (int)mass));
     }
     if(txt_){
       TString path;
@@ -319,30 +343,25 @@ PlotLimits::plot2DScan(TCanvas& canv, const char* directory)
       print(path, xval, yval, graph95, "txt"); print(path, xval, yval, graph95, "tex");
     }
     if(root_){
-      TFile* output = new TFile(TString::Format("scan-%s-versus-%s.root", xval.c_str(), yval.c_str()), "update");
-      if(!output->cd(output_.c_str())){
-	output->mkdir(output_.c_str());
-	output->cd(output_.c_str());
-      }
+      std::string output(TString::Format("scan-%s-versus-%s.root", xval.c_str(), yval.c_str()));
       int idx=0;
       for(std::vector<TGraph*>::const_iterator g=graph68.begin() ; g!=graph68.end() ; ++g){
-	(*g)->Write(TString::Format("graph68_%d_%d"  , (int)mass , idx++)); 
+	OutputWriter::instance().write(output, output_, *g, TString::Format("graph68_%d_%d"  , (int)mass , idx++)); 
       }
       idx=0;
       for(std::vector<TGraph*>::const_iterator g=filled68.begin(); g!=filled68.end(); ++g){
-	(*g)->Write(TString::Format("filled68_%d_%d" , (int)mass , idx++)); 
+	OutputWriter::instance().write(output, output_, *g, TString::Format("filled68_%d_%d" , (int)mass , idx++)); 
       }
       idx=0;
       for(std::vector<TGraph*>::const_iterator g=graph95.begin() ; g!=graph95.end() ; ++g){
-	(*g)->Write(TString::Format("graph95_%d_%d"  , (int)mass , idx++)); 
+	OutputWriter::instance().write(output, output_, *g, TString::Format("graph95_%d_%d"  , (int)mass , idx++)); 
       }
       idx=0;
       for(std::vector<TGraph*>::const_iterator g=filled95.begin(); g!=filled95.end(); ++g){
-	(*g)->Write(TString::Format("filled95_%d_%d" , (int)mass , idx++)); 
+	OutputWriter::instance().write(output, output_, *g, TString::Format("filled95_%d_%d" , (int)mass , idx++)); 
       }
-      if(bestfit ){ bestfit ->Write(TString::Format("bestfit_%d"  , (int)mass) ); }
-      plot2D  ->Write(TString::Format("plot2D_%d"   , (int)mass) );
-      output->Close();
+      if(bestfit ){ OutputWriter::instance().write(output, output_, bestfit, TString::Format("bestfit_%d"  , (int)mass)); }
+      OutputWriter::instance().write(output, output_, plot2D, TString::Format("plot2D_%d"   , (int)mass));
     }
   }
   return;
@@ -0,0 +1,164 @@
+#include <stdlib.h>
+#include <fstream>
+#include <iostream>
+
+#include "TH1.h"
+#include "TFile.h"
+#include "TThread.h"
+#include "TString.h"
+#include "HiggsAnalysis/HiggsToTauTau/interface/Profile.h"
+#include "HiggsAnalysis/HiggsToTauTau/interface/OutputWriter.h"
+
+OutputWriter&
+OutputWriter::instance()
+{
+  static OutputWriter* writer = 0;
+  if(!writer){
+    writer = new OutputWriter();
+    // registered after the initialization of ROOT, therefore executed before its cleanup
+    atexit(&OutputWriter::finish);
+  }
+  return *writer;
+}
+
+void
+OutputWriter::finish()
+{
+  instance().flush();
+}
+
+void
+OutputWriter::threads(unsigned int nthreads)
+{
+  if(nthreads!=nthreads_){
+    flush(); nthreads_=nthreads;
+  }
+}
+
+void
+OutputWriter::write(const std::string& filename, const std::string& content)
+{
+  Task task;
+  task.filename = filename;
+  task.content  = content;
+  submit(task);
+}
+
+void
+OutputWriter::write(const std::string& filename, const std::string& directory, const TObject* object, const char* name)
+{
+  if(!object){
+    return;
+  }
+  TObject* clone = object->Clone();
+  if(clone->InheritsFrom(TH1::Class())){
+    // detach histograms from the current directory, which might be closed before the write
+    ((TH1*)clone)->SetDirectory(0);
+  }
+  summaries_[filename][directory].push_back(std::make_pair(std::string(name), clone));
+}
+
+void
+OutputWriter::submit(const Task& task)
+{
+  if(nthreads_==0){
+    Task buffer(task);
+    execute(buffer);
+    return;
+  }
+  if(workers_.empty()){
+    TThread::Initialize();
+    for(unsigned int iworker=0; iworker<nthreads_; ++iworker){
+      workers_.push_back(new Worker());
+      workers_.back()->thread = new TThread(TString::Format("OutputWriter%d", iworker), &OutputWriter::work, workers_.back());
+      workers_.back()->thread->Run();
+    }
+  }
+  // all writes to the same file go to the same worker to keep them in order
+  unsigned int hash=0;
+  for(std::string::const_iterator c=task.filename.begin(); c!=task.filename.end(); ++c){
+    hash = 31*hash+*c;
+  }
+  Worker* worker = workers_[hash%workers_.size()];
+  worker->mutex.Lock();
+  worker->tasks.push_back(task);
+  worker->condition.Signal();
+  worker->mutex.UnLock();
+}
+
+void
+OutputWriter::flush()
+{
+  Profile::Timer timer("OutputWriter: flush");
+  // one write per root file for all objects that have been collected so far
+  for(std::map<std::string, Summary>::iterator summary=summaries_.begin(); summary!=summaries_.end(); ++summary){
+    Task task;
+    task.filename = summary->first;
+    task.summary.swap(summary->second);
+    submit(task);
+  }
+  summaries_.clear();
+  for(std::vector<Worker*>::iterator worker=workers_.begin(); worker!=workers_.end(); ++worker){
+    (*worker)->mutex.Lock();
+    (*worker)->stop = true;
+    (*worker)->condition.Signal();
+    (*worker)->mutex.UnLock();
+  }
+  for(std::vector<Worker*>::iterator worker=workers_.begin(); worker!=workers_.end(); ++worker){
+    (*worker)->thread->Join();
+    delete (*worker)->thread;
+    delete *worker;
+  }
+  workers_.clear();
+}
+
+void*
+OutputWriter::work(void* arg)
+{
+  Worker* worker = (Worker*)arg;
+  while(true){
+    worker->mutex.Lock();
+    while(worker->tasks.empty() && !worker->stop){
+      worker->condition.Wait();
+    }
+    if(worker->tasks.empty()){
+      // stop requested and nothing left to do
+      worker->mutex.UnLock();
+      break;
+    }
+    Task task(worker->tasks.front()); worker->tasks.pop_front();
+    worker->mutex.UnLock();
+    execute(task);
+  }
+  return 0;
+}
+
+void
+OutputWriter::execute(Task& task)
+{
+  if(task.summary.empty()){
+    std::ofstream file(task.filename.c_str());
+    file << task.content;
+    return;
+  }
+  TFile* output = new TFile(task.filename.c_str(), "update");
+  if(output->IsZombie()){
+    std::cout << "ERROR: could not open file: " << task.filename << std::endl;
+  }
+  for(Summary::iterator directory=task.summary.begin(); directory!=task.summary.end(); ++directory){
+    if(!output->IsZombie()){
+      if(!output->cd(directory->first.c_str())){
+	output->mkdir(directory->first.c_str());
+	output->cd(directory->first.c_str());
+      }
+    }
+    for(std::vector<std::pair<std::string, TObject*> >::iterator object=directory->second.begin(); object!=directory->second.end(); ++object){
+      if(!output->IsZombie()){
+	object->second->Write(object->first.c_str());
+      }
+      delete object->second;
+    }
+  }
+  output->Close();
+  delete output;
+}
@@ -1,6 +1,6 @@
 #include "HiggsAnalysis/HiggsToTauTau/interface/PlotLimits.h"
 
-PlotLimits::PlotLimits(const char* output, const edm::ParameterSet& cfg) : 
+PlotLimits::PlotLimits(const char* output, const edm::ParameterSet& cfg, LimitCache* cache) : 
   output_(output),
   dataset_(cfg.getParameter<std::string>("dataset")),
   xaxis_(cfg.getParameter<std::string>("xaxis")),
@@ -12,7 +12,9 @@ PlotLimits::PlotLimits(const char* output, const edm::ParameterSet& cfg) :
   pdf_  (cfg.existsAs<bool  >("pdf" ) ? cfg.getParameter<bool  >("pdf" ) : false),
   txt_  (cfg.existsAs<bool  >("txt" ) ? cfg.getParameter<bool  >("txt" ) : false),
   root_ (cfg.existsAs<bool  >("root") ? cfg.getParameter<bool  >("root") : false),
-  mssm_ (cfg.existsAs<bool  >("mssm") ? cfg.getParameter<bool  >("mssm") : false)
+  mssm_ (cfg.existsAs<bool  >("mssm") ? cfg.getParameter<bool  >("mssm") : false),
+  buffer_(cfg.existsAs<unsigned int>("verbosity") ? cfg.getParameter<unsigned int>("verbosity") : 0),
+  cache_(cache ? *cache : buffer_)
 {
   // mass-points
   bins_=cfg.getParameter<std::vector<double> >("masspoints");
@@ -54,7 +56,16 @@ PlotLimits::PlotLimits(const char* output, const edm::ParameterSet& cfg) :
   }
   // common configs
   label_ = cfg.existsAs<std::string>("outputLabel") ? cfg.getParameter<std::string>("outputLabel") : std::string();
-  verbosity_ = cfg.existsAs<unsigned int>("verbosity") ? cfg.getParameter<unsigned int>("verbosity") : 0,
+  verbosity_ = cfg.existsAs<unsigned int>("verbosity") ? cfg.getParameter<unsigned int>("verbosity") : 0;
+  threads_ = cfg.existsAs<unsigned int>("threads") ? cfg.getParameter<unsigned int>("threads") : 1;
+  // background writing of the output files is configured separately (0: synchronous)
+  OutputWriter::instance().threads(cfg.existsAs<unsigned int>("writeThreads") ? cfg.getParameter<unsigned int>("writeThreads") : 0);
+  // profiling of the phases of the tool
+  std::string profile = cfg.existsAs<std::string>("profile") ? cfg.getParameter<std::string>("profile") : std::string();
+  if(verbosity_>0 || !profile.empty()){
+    Profile::instance().enable(profile.find(".json")!=std::string::npos ? profile : std::string());
+  }
+  toySketch_ = cfg.existsAs<unsigned int>("toySketch") ? cfg.getParameter<unsigned int>("toySketch") : 0;
   // specifics to plot signal strength
   signal_ = cfg.existsAs<std::string>("signal") ? cfg.getParameter<std::string>("signal") : std::string();
   // specifics to plot scan-2d
@@ -288,3 +299,11 @@ PlotLimits::maximum(TGraph* graph)
   std::cout << "M A X I M U M   I S : " << maximum << std::endl;
   return maximum;
 }
+
+void
+PlotLimits::printCanvas(TCanvas& canv, const char* filename)
+{
+  std::string name(filename);
+  Profile::Timer timer(std::string("TCanvas::Print(").append(name.substr(name.rfind(".")+1)).append(")").c_str());
+  canv.Print(filename);
+}
@@ -3,31 +3,21 @@
 void
 PlotLimits::prepareByFitOutput(const char* directory, std::vector<double>& values, const char* filename, const char* treename, const char* branchname)
 {
+  Profile::Timer timer("PlotLimits: prepareByFitOutput");
+  // determine all paths first to allow concurrent reading of the files
+  std::vector<std::string> fullpaths;
+  for(unsigned int imass=0; imass<bins_.size(); ++imass){
+    fullpaths.push_back(TString::Format("%s/%d/%s.root", directory, (int)bins_[imass], filename).Data());
+  }
+  cache_.prefetch(fullpaths, threads_, treename, branchname, 0);
   for(unsigned int imass=0; imass<bins_.size(); ++imass){
     double value=-1.;
-    TString fullpath(TString::Format("%s/%d/%s.root", directory, (int)bins_[imass], filename));
-    if(verbosity_>0) std::cout << "INFO: opening file " << fullpath << std::endl;
-    TFile* file = new TFile(fullpath);
-    if(file->IsZombie()){
-      if(verbosity_>0){ std::cout << "INFO: file not found: " << fullpath  << std::endl; }
+    const LimitCache::Entry& limit = cache_.get(fullpaths[imass].c_str(), treename, branchname, 0);
+    if(!limit.valid){
       valid_[imass]=false;
     }
-    else{
-      TTree* limit = (TTree*) file->Get(treename);
-      if(!limit){
-	if(verbosity_>0){ std::cout << "INFO: tree 'limit' not found: limit" << std::endl; }
-	valid_[imass]=false;
-      }
-      else{
-	double x;
-	limit->SetBranchAddress(branchname, &x);
-	int nevent = limit->GetEntries();
-	for(int i=0; i<nevent; ++i){
-	  limit->GetEvent(i);
-	  value = x;
-	}
-      }
-      file->Close();
+    else if(!limit.values.empty()){
+      value = limit.values.back();
     }
     values.push_back(value);
   }
@@ -37,104 +27,107 @@ PlotLimits::prepareByFitOutput(const char* directory, std::vector<double>& value
 void
 PlotLimits::prepareByFile(const char* directory, std::vector<double>& values, const char* filename)
 {
+  Profile::Timer timer("PlotLimits: prepareByFile");
+  // determine all paths first to allow concurrent reading of the files
+  std::vector<std::string> fullpaths;
   for(unsigned int imass=0; imass<bins_.size(); ++imass){
-    double value=-1.;
     std::string buffer = std::string(filename);
     std::string filehead = buffer.substr(0, buffer.find("$MASS"));
     std::string filetail = buffer.substr(buffer.find("$MASS")+5, std::string::npos);
-    TString fullpath(TString::Format("%s/%d/%s%d%s.root", directory, (int)bins_[imass], filehead.c_str(), (int)bins_[imass], filetail.c_str()));
-    if(verbosity_>0) std::cout << "INFO: opening file " << fullpath << std::endl;
-    TFile* file = new TFile(fullpath);
-    if(file->IsZombie()){
-      if(verbosity_>0){ std::cout << "INFO: file not found: " << fullpath  << std::endl; }
+    fullpaths.push_back(TString::Format("%s/%d/%s%d%s.root", directory, (int)bins_[imass], filehead.c_str(), (int)bins_[imass], filetail.c_str()).Data());
+  }
+  // pick up the harvested limit store of the directory, if present
+  cache_.load(directory);
+  cache_.prefetch(fullpaths, threads_);
+  for(unsigned int imass=0; imass<bins_.size(); ++imass){
+    double value=-1.;
+    const LimitCache::Entry& limit = cache_.get(fullpaths[imass].c_str());
+    if(!limit.valid){
       valid_[imass]=false;
     }
-    else{
-      TTree* limit = (TTree*) file->Get("limit");
-      if(!limit){
-	if(verbosity_>0){ std::cout << "INFO: tree 'limit' not found: limit" << std::endl; }
-	valid_[imass]=false;
-      }
-      else{
-	double x;
-	limit->SetBranchAddress("limit", &x);
-	int nevent = limit->GetEntries();
-	for(int i=0; i<nevent; ++i){
-	  limit->GetEvent(i);
-	  value = x;
-	}
-      }
-      file->Close();
+    else if(!limit.values.empty()){
+      value = limit.values.back();
     }
     values.push_back(value);
   }
   return;
 }
 
+/// sink for LimitCache::stream to fill the toys of a file into a ToyQuantiles
+static void fillToys(double x, void* toys)
+{
+  ((ToyQuantiles*)toys)->fill(x);
+}
+
+const ToyQuantiles&
+PlotLimits::toyQuantiles(const char* fullpath)
+{
+  std::map<std::string, ToyQuantiles>::iterator toys = toys_.find(fullpath);
+  if(toys!=toys_.end()){
+    return toys->second;
+  }
+  // all quantiles that are used for the bands are determined at once
+  std::vector<double> probs;
+  probs.push_back(0.027); probs.push_back(0.160); probs.push_back(0.500); probs.push_back(0.840); probs.push_back(0.975);
+  toys = toys_.insert(std::make_pair(std::string(fullpath), ToyQuantiles(probs, toySketch_))).first;
+  Profile::Timer timer("PlotLimits: toyQuantiles");
+  if(toySketch_==0){
+    // exact quantiles from the buffered file content
+    const LimitCache::Entry& limit = cache_.get(fullpath, "limit", "limit", 0);
+    if(limit.valid){
+      toys->second.fill(limit.values);
+    }
+  }
+  else{
+    // stream the toys through the sketch w/o buffering them; the file is still
+    // tracked by the cache, such that session and watch mode see its changes
+    cache_.stream(fullpath, &fillToys, &(toys->second), "limit", "limit");
+    timer.count(toys->second.size());
+  }
+  if(verbosity_>0){
+    std::cout << "INFO: " << toys->second.size() << " toys in " << fullpath << " (mean = " << toys->second.mean() 
+	      << ", rms = " << sqrt(toys->second.var()) << (toys->second.sketched() ? ", quantiles estimated" : "") << ")" << std::endl;
+  }
+  return toys->second;
+}
+
 void
 PlotLimits::prepareByToy(const char* directory, std::vector<double>& values, const char* type)
 {
+  Profile::Timer timer("PlotLimits: prepareByToy");
+  // determine all paths first to allow concurrent reading of the files
+  std::vector<std::string> fullpaths;
+  for(unsigned int imass=0; imass<bins_.size(); ++imass){
+    fullpaths.push_back(TString::Format("%s/%d/batch_collected_%s.root", directory, (int)bins_[imass], label_.c_str()).Data());
+  }
+  // in sketch mode the toys are streamed file by file on request, buffering them
+  // in advance would defeat the purpose of the sketch
+  if(toySketch_==0){
+    cache_.prefetch(fullpaths, threads_, "limit", "limit", 0);
+  }
   for(unsigned int imass=0; imass<bins_.size(); ++imass){
-    // buffer mass
-    float mass = bins_[imass];
-
     double value=-1.;
-    TString fullpath(TString::Format("%s/%d/batch_collected_%s.root", directory, (int)mass, label_.c_str()));
-    if(verbosity_>0) std::cout << "INFO: opening file " << fullpath << std::endl;
-    TFile* file = new TFile(fullpath);
-    if(file->IsZombie()){
-      if(verbosity_>0){ std::cout << "INFO: file not found: " << fullpath  << std::endl; }
+    // mean, variance and all quantiles are determined on first request for
+    // a given file, all further requests are served from memory
+    const ToyQuantiles& toys = toyQuantiles(fullpaths[imass].c_str());
+    if(toys.size()==0){
       valid_[imass]=false;
     }
     else{
-      TTree* limit = (TTree*) file->Get("limit");
-      if(!limit){
-	if(verbosity_>0){ std::cout << "INFO: tree not found: limit" << std::endl; }
-	valid_[imass]=false;
-      }
+      // using standard deviations can result in bands that span below 0
+      // we therefore use quantiles here for +/-1 and +/-2 sigma. The
+      // mean remains as is.
+      if(std::string(type)==std::string("MEAN")){ value= toys.mean(); }
+      else if(std::string(type)==std::string("+2SIGMA")){ value= toys.quantile(0.975);}//+2*sqrt(var);}
+      else if(std::string(type)==std::string("+1SIGMA")){ value= toys.quantile(0.840);}//+1*sqrt(var);}
+      else if(std::string(type)==std::string( "MEDIAN")){ value= toys.quantile(0.500);}
+      else if(std::string(type)==std::string("-1SIGMA")){ value= toys.quantile(0.160);}//-1*sqrt(var);}
+      else if(std::string(type)==std::string("-2SIGMA")){ value= toys.quantile(0.027);}//-2*sqrt(var);}
       else{
-	double x;
-	double mean=0, var=0;
-	// vector for simple median determination
-	std::vector<double> limits;
-	limit->SetBranchAddress("limit", &x);
-	int nevent = limit->GetEntries();
-    for(int i=0; i<nevent; ++i){
-      limit->GetEvent(i);
-	  // fill for median determination
-	  limits.push_back(x);
-	  // mean(x)
-	  mean +=1./(i+1)*(x-mean);
-	  // mean(x**2)
-	  var  +=1./(i+1)*(x*x-var);
-	}
-	// var = mean(x**2)-mean(x)**2
-	var-= mean*mean;
-	// sort for quantile determination
-	std::sort(limits.begin(), limits.end());
-	
-	/*
-	for(unsigned int i=0; i<limits.size(); ++i){
-	  var+=1./limits.size()*(limits[i]-mean)*(limits[i]-mean);
-	}
-	*/
-
-	// using standard deviations can result in bands that span below 0
-	// we therefore use quantiles here for +/-1 and +/-2 sigma. The
-	// mean remains as is.
-	if(std::string(type)==std::string("MEAN")){ value= mean; }
-	else if(std::string(type)==std::string("+2SIGMA")){ value= limits[(int)(0.975*limits.size())];}//+2*sqrt(var);}
-	else if(std::string(type)==std::string("+1SIGMA")){ value= limits[(int)(0.840*limits.size())];}//+1*sqrt(var);}
-	else if(std::string(type)==std::string( "MEDIAN")){ value= limits[(int)(0.500*limits.size())];}
-	else if(std::string(type)==std::string("-1SIGMA")){ value= limits[(int)(0.160*limits.size())];}//-1*sqrt(var);}
-	else if(std::string(type)==std::string("-2SIGMA")){ value= limits[(int)(0.027*limits.size())];}//-2*sqrt(var);}
-	else{
-	  std::cout << "ERROR: picked wrong type. Available types are: +2sigma, +1sigma, mean, median, -1sigma, -2sigma" << std::endl
-		    << "       for the moment I'll stop here" << std::endl;
-	  exit(1);
-	}
+	std::cout << "ERROR: picked wrong type. Available types are: +2sigma, +1sigma, mean, median, -1sigma, -2sigma" << std::endl
+		  << "       for the moment I'll stop here" << std::endl;
+	exit(1);
       }
-      file->Close();
     }
     values.push_back(value);
   }
@@ -144,39 +137,34 @@ PlotLimits::prepareByToy(const char* directory, std::vector<double>& values, con
 void
 PlotLimits::prepareByValue(const char* directory, std::vector<double>& values, const char* filename, float ConLevel)
 {
+  Profile::Timer timer("PlotLimits: prepareByValue");
+  // determine all paths first to allow concurrent reading of the files
+  std::vector<std::string> fullpaths;
   for(unsigned int imass=0; imass<bins_.size(); ++imass){
     // buffer mass
     float mass = bins_[imass];
-    double value=-1.;
     std::string buffer = std::string(filename);
     std::string filehead = buffer.substr(0, buffer.find("$MASS"));
     std::string filetail = buffer.substr(buffer.find("$MASS")+5, std::string::npos);
-    TString fullpath(TString::Format("%s/%d/%s%d%s.root", directory, (int)mass, filehead.c_str(), (int)mass, filetail.c_str()));
-    if(verbosity_>0) std::cout << "INFO: opening file " << fullpath << std::endl;
-    TFile* file = new TFile(fullpath);
-    if(file->IsZombie()){
-      if(verbosity_>0){ std::cout << "INFO: file not found: " << fullpath  << std::endl; }
+    fullpaths.push_back(TString::Format("%s/%d/%s%d%s.root", directory, (int)mass, filehead.c_str(), (int)mass, filetail.c_str()).Data());
+  }
+  // pick up the harvested limit store of the directory, if present
+  cache_.load(directory);
+  cache_.prefetch(fullpaths, threads_);
+  for(unsigned int imass=0; imass<bins_.size(); ++imass){
+    double value=-1.;
+    // all quantiles of the file are read on first request, all further 
+    // requests for the same file are served from memory
+    const LimitCache::Entry& limit = cache_.get(fullpaths[imass].c_str());
+    if(!limit.valid){
       valid_[imass]=false;
     }
     else{
-      TTree* limit = (TTree*) file->Get("limit");
-      if(!limit){
-	if(verbosity_>0){ std::cout << "INFO: tree not found: limit" << std::endl; }
-	valid_[imass]=false;
-      }
-      else{
-	double x; float y;
-	limit->SetBranchAddress("limit", &x);
-	limit->SetBranchAddress("quantileExpected", &y);
-	int nevent = limit->GetEntries();
-	for(int i=0; i<nevent; ++i){
-	  limit->GetEvent(i);
-	  if(y==ConLevel){
-	    value = x;
-	  }
+      for(unsigned int i=0; i<limit.quantiles.size(); ++i){
+	if(limit.quantiles[i]==ConLevel){
+	  value = limit.values[i];
 	}
       }
-      file->Close();
     }
     values.push_back(value);
   }
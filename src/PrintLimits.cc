@@ -4,8 +4,8 @@ void
 PlotLimits::print(const char* filename, std::string& xval, std::string& yval, std::vector<TGraph*> contour, const char* type)
 {
   if(std::string(type) == std::string("tex")){
-    ofstream file;
-    file.open (std::string(filename).append(".tex").c_str());
+    std::string path(std::string(filename).append(".tex"));
+    std::ostringstream file;
     file
       << "   " << std::setw(15) << std::right << xval << " (pb) " 
       << " & " << std::setw(15) << std::right << yval << " (pb) "
@@ -21,10 +21,11 @@ PlotLimits::print(const char* filename, std::string& xval, std::string& yval, st
 	  << std::endl << "\\hline" << std::endl;
       }
     }
+    OutputWriter::instance().write(path, file.str());
   }
   if(std::string(type) == std::string("txt")){
-    ofstream file;
-    file.open (std::string(filename).append(".txt").c_str());
+    std::string path(std::string(filename).append(".txt"));
+    std::ostringstream file;
     file
       << "   " << std::setw(15) << std::right << xval 
       << "   " << std::setw(15) << std::right << yval
@@ -38,6 +39,7 @@ PlotLimits::print(const char* filename, std::string& xval, std::string& yval, st
 	  << std::endl;
       }
     }
+    OutputWriter::instance().write(path, file.str());
   }
 }
 
@@ -45,8 +47,8 @@ void
 PlotLimits::print(const char* filename, TGraphAsymmErrors* outerBand, TGraphAsymmErrors* innerBand, TGraph* expected, TGraph* observed, const char* type)
 {
   if(std::string(type) == std::string("tex")){
-    ofstream file;
-    file.open (std::string(filename).append(".tex").c_str());
+    std::string path(std::string(filename).append(".tex"));
+    std::ostringstream file;
     file
       << "   " << std::setw(15) << std::right << "    $m_{\\mathrm H}$";
     if(outerBand){
@@ -89,11 +91,11 @@ PlotLimits::print(const char* filename, TGraphAsymmErrors* outerBand, TGraphAsym
 	<< std::right << "  \\\\"
 	<< std::endl << "\\hline" << std::endl;
     }
-    file.close();
+    OutputWriter::instance().write(path, file.str());
   }
   if(std::string(type) == std::string("txt")){
-    ofstream file;
-    file.open (std::string(filename).append(".txt").c_str());
+    std::string path(std::string(filename).append(".txt"));
+    std::ostringstream file;
     file
       << "#"
       << "   " << std::setw(15) << std::right << "         mX";
@@ -134,7 +136,7 @@ PlotLimits::print(const char* filename, TGraphAsymmErrors* outerBand, TGraphAsym
       file
 	<< std::endl;
     }
-    file.close();
+    OutputWriter::instance().write(path, file.str());
   }
 }
 
@@ -142,8 +144,8 @@ void
 PlotLimits::print(const char* filename, TGraph* expected, TGraph* observed, const char* type)
 {
   if(std::string(type) == std::string("tex")){
-    ofstream file;
-    file.open (std::string(filename).append(".tex").c_str());
+    std::string path(std::string(filename).append(".tex"));
+    std::ostringstream file;
     file
       << "   " << std::setw(15) << std::right << "    $m_{\\mathrm H}$"
       << " & " << std::setw(15) << std::right << "$-2\\sigma$"
@@ -171,11 +173,11 @@ PlotLimits::print(const char* filename, TGraph* expected, TGraph* observed, cons
 	<< std::right << "  \\\\"
 	<< std::endl << "\\hline" << std::endl;
     }
-    file.close();
+    OutputWriter::instance().write(path, file.str());
   }
   if(std::string(type) == std::string("txt")){
-    ofstream file;
-    file.open (std::string(filename).append(".txt").c_str());
+    std::string path(std::string(filename).append(".txt"));
+    std::ostringstream file;
     file
       << "#"
       << "   " << std::setw(15) << std::right << "         mX"
@@ -201,7 +203,7 @@ PlotLimits::print(const char* filename, TGraph* expected, TGraph* observed, cons
       file
 	<< std::endl;
     }
-    file.close();
+    OutputWriter::instance().write(path, file.str());
   }
 }
 
@@ -0,0 +1,139 @@
+#include <stdlib.h>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <sys/time.h>
+
+#include "TThread.h"
+#include "HiggsAnalysis/HiggsToTauTau/interface/Profile.h"
+
+Profile::Timer::Timer(const char* name, Long64_t count) :
+  count_(count),
+  start_(-1.)
+{
+  if(Profile::instance().active()){
+    name_=name; start_=Profile::now();
+  }
+}
+
+Profile::Timer::~Timer()
+{
+  if(start_>=0.){
+    Profile::instance().add(name_, start_, Profile::now(), count_);
+  }
+}
+
+Profile&
+Profile::instance()
+{
+  static Profile* profile = 0;
+  if(!profile){
+    profile = new Profile();
+    atexit(&Profile::exit);
+  }
+  return *profile;
+}
+
+void
+Profile::exit()
+{
+  instance().finish();
+}
+
+double
+Profile::now()
+{
+  struct timeval time;
+  gettimeofday(&time, 0);
+  return 1e6*time.tv_sec+time.tv_usec;
+}
+
+void
+Profile::enable(const std::string& trace)
+{
+  active_=true;
+  if(!trace.empty() && trace!=trace_){
+    trace_=trace; traceEnd_=-1;
+  }
+}
+
+void
+Profile::add(const std::string& name, double start, double stop, Long64_t count)
+{
+  mutex_.Lock();
+  Phase& phase = phases_[name];
+  ++phase.calls;
+  phase.total+=stop-start;
+  phase.max = std::max(phase.max, stop-start);
+  phase.count+=count;
+  if(!trace_.empty()){
+    Event event;
+    event.name=name; event.start=start; event.duration=stop-start; event.thread=TThread::SelfId(); event.count=count;
+    events_.push_back(event);
+  }
+  mutex_.UnLock();
+}
+
+void
+Profile::finish(std::ostream& out)
+{
+  mutex_.Lock();
+  if(!active_ || phases_.empty()){
+    mutex_.UnLock();
+    return;
+  }
+  // the format of out is restored at the end, out is usually std::cout
+  std::ios_base::fmtflags flags = out.flags();
+  std::streamsize precision = out.precision();
+  out << "PROFILE:" << std::endl
+      << "  " << std::setw(40) << std::left << "phase"
+      << std::setw(10) << std::right << "calls"
+      << std::setw(14) << std::right << "total [ms]"
+      << std::setw(14) << std::right << "mean [ms]"
+      << std::setw(14) << std::right << "max [ms]"
+      << std::setw(14) << std::right << "count"
+      << std::endl;
+  for(std::map<std::string, Phase>::const_iterator phase=phases_.begin(); phase!=phases_.end(); ++phase){
+    out << "  " << std::setw(40) << std::left << phase->first
+	<< std::setw(10) << std::right << phase->second.calls
+	<< std::setw(14) << std::right << std::fixed << std::setprecision(3) << phase->second.total/1e3
+	<< std::setw(14) << std::right << std::fixed << std::setprecision(3) << phase->second.total/1e3/phase->second.calls
+	<< std::setw(14) << std::right << std::fixed << std::setprecision(3) << phase->second.max/1e3
+	<< std::setw(14) << std::right << phase->second.count
+	<< std::endl;
+  }
+  if(!trace_.empty()){
+    // the events of all passes (e.g. of plot --watch) are collected in the same trace: the first
+    // pass creates the file, all later passes overwrite its closing brackets with their events
+    std::fstream file;
+    if(traceEnd_<0){
+      file.open(trace_.c_str(), std::ios::out | std::ios::trunc);
+      file << "{\"traceEvents\":[";
+    }
+    else{
+      file.open(trace_.c_str(), std::ios::in | std::ios::out);
+      file.seekp(traceEnd_);
+    }
+    for(std::vector<Event>::const_iterator event=events_.begin(); event!=events_.end(); ++event){
+      file << (event==events_.begin() && traceEnd_<0 ? "\n" : ",\n")
+	   << "{\"name\":\"" << event->name << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event->thread
+	   << ",\"ts\":" << std::fixed << std::setprecision(0) << event->start
+	   << ",\"dur\":" << std::fixed << std::setprecision(0) << event->duration
+	   << ",\"args\":{\"count\":" << event->count << ",\"pass\":" << passes_ << "}}";
+    }
+    if(!events_.empty() || traceEnd_<0){
+      traceEnd_ = file.tellp();
+    }
+    file << std::endl << "]}" << std::endl;
+    if(file.good()){
+      out << "INFO: profile trace written to " << trace_ << std::endl;
+    }
+    else{
+      out << "ERROR: could not write profile trace " << trace_ << std::endl;
+    }
+  }
+  ++passes_;
+  out.flags(flags); out.precision(precision);
+  phases_.clear(); events_.clear();
+  mutex_.UnLock();
+}
@@ -55,25 +55,20 @@ PlotLimits::plotSignalStrength(TCanvas& canv, TGraphAsymmErrors* innerBand, TGra
   //CMSPrelim(dataset_.c_str(), "", 0.145, 0.835);
   // write results to files
   if(png_){
-    canv.Print(std::string(output_).append("_").append(label_).append(".png").c_str());
+    printCanvas(canv, std::string(output_).append("_").append(label_).append(".png").c_str());
   }
   if(pdf_){
-    canv.Print(std::string(output_).append("_").append(label_).append(".pdf").c_str());
-    canv.Print(std::string(output_).append("_").append(label_).append(".eps").c_str());
+    printCanvas(canv, std::string(output_).append("_").append(label_).append(".pdf").c_str());
+    printCanvas(canv, std::string(output_).append("_").append(label_).append(".eps").c_str());
   }
   if(txt_){
     print(std::string(output_).append("_").append(label_).c_str(), 0, innerBand, central, 0, "txt");
     print(std::string(output_).append("_").append(label_).c_str(), 0, innerBand, central, 0, "tex");
   }
   if(root_){
-    TFile* output = new TFile(std::string("signal-strength-").append(label_).append(".root").c_str(), "update");
-    if(!output->cd(output_.c_str())){
-      output->mkdir(output_.c_str());
-      output->cd(output_.c_str());
-    }
-    central  ->Write("bestFit" );
-    innerBand->Write("innerBand");
-    output->Close();
+    std::string output(std::string("signal-strength-").append(label_).append(".root"));
+    OutputWriter::instance().write(output, output_, central, "bestFit");
+    OutputWriter::instance().write(output, output_, innerBand, "innerBand");
   }
   return;
 }
@@ -79,33 +79,28 @@ PlotLimits::plotTanb(TCanvas& canv, TGraphAsymmErrors* innerBand, TGraphAsymmErr
   CMSPrelim(dataset_.c_str(), "", 0.145, 0.835);
   // write results to files
   if(png_){
-    canv.Print(std::string(output_).append("_").append(label_).append(".png").c_str());
+    printCanvas(canv, std::string(output_).append("_").append(label_).append(".png").c_str());
   }
   if(pdf_){
-    canv.Print(std::string(output_).append("_").append(label_).append(".pdf").c_str());
-    canv.Print(std::string(output_).append("_").append(label_).append(".eps").c_str());
+    printCanvas(canv, std::string(output_).append("_").append(label_).append(".pdf").c_str());
+    printCanvas(canv, std::string(output_).append("_").append(label_).append(".eps").c_str());
   }
   if(txt_){
     print(std::string(output_).append("_").append(label_).c_str(), outerBand, innerBand, expected, observed, "txt");
     print(std::string(output_).append("_").append(label_).c_str(), outerBand, innerBand, expected, observed, "tex");
   }
   if(root_){
-    TFile* output = new TFile(std::string("limits_").append(label_).append(".root").c_str(), "update");
-    if(!output->cd(output_.c_str())){
-      output->mkdir(output_.c_str());
-      output->cd(output_.c_str());
-    }
+    std::string output(std::string("limits_").append(label_).append(".root"));
     if(observed){ 
-      observed ->Write("observed" );
+      OutputWriter::instance().write(output, output_, observed, "observed");
     }
-    expected ->Write("expected" );
-    innerBand->Write("innerBand");
-    outerBand->Write("outerBand");
+    OutputWriter::instance().write(output, output_, expected, "expected");
+    OutputWriter::instance().write(output, output_, innerBand, "innerBand");
+    OutputWriter::instance().write(output, output_, outerBand, "outerBand");
     // auxiliary graphs
-    upperLEP->Write("upperLEP");
-    lowerLEP->Write("lowerLEP");
-    plain->Write("plain");
-    output->Close();
+    OutputWriter::instance().write(output, output_, upperLEP, "upperLEP");
+    OutputWriter::instance().write(output, output_, lowerLEP, "lowerLEP");
+    OutputWriter::instance().write(output, output_, plain, "plain");
   }
   return;
 }
@@ -0,0 +1,143 @@
+#include <math.h>
+#include <algorithm>
+
+#include "HiggsAnalysis/HiggsToTauTau/interface/ToyQuantiles.h"
+
+ToyQuantiles::ToyQuantiles(const std::vector<double>& probs, unsigned int sketch) :
+  probs_(probs),
+  max_(sketch),
+  n_(0),
+  mean_(0.),
+  sqr_(0.),
+  sketched_(false),
+  selected_(false)
+{
+}
+
+void
+ToyQuantiles::fill(const std::vector<double>& xs)
+{
+  if(!sketched_ && (max_==0 || n_+xs.size()<=max_)){
+    values_.reserve(values_.size()+xs.size());
+  }
+  for(std::vector<double>::const_iterator x=xs.begin(); x!=xs.end(); ++x){
+    fill(*x);
+  }
+}
+
+void
+ToyQuantiles::fill(double x)
+{
+  ++n_;
+  // mean(x)
+  mean_+=1./n_*(x-mean_);
+  // mean(x**2)
+  sqr_ +=1./n_*(x*x-sqr_);
+  if(sketched_){
+    for(std::vector<Markers>::iterator markers=markers_.begin(); markers!=markers_.end(); ++markers){
+      update(*markers, x);
+    }
+    return;
+  }
+  values_.push_back(x); selected_=false;
+  if(max_>0 && values_.size()>max_ && values_.size()>=5){
+    sketch();
+  }
+}
+
+void
+ToyQuantiles::sketch()
+{
+  // initialize the markers from the buffered values as if they had been
+  // filled one by one starting from the five smallest values
+  std::sort(values_.begin(), values_.end());
+  markers_.resize(probs_.size());
+  for(unsigned int iprob=0; iprob<probs_.size(); ++iprob){
+    Markers& markers = markers_[iprob];
+    double p = probs_[iprob];
+    double inc[5] = {0., p/2., p, (1.+p)/2., 1.};
+    for(unsigned int i=0; i<5; ++i){
+      // place the markers at the desired positions of the buffered sample
+      unsigned int idx = (unsigned int)floor(inc[i]*(values_.size()-1)+0.5);
+      // marker positions have to be strictly increasing
+      idx = std::min(std::max(idx, i), (unsigned int)values_.size()-5+i);
+      if(i>0 && idx<=markers.n[i-1]-1){ idx=(unsigned int)markers.n[i-1]; }
+      markers.q[i]   = values_[idx];
+      markers.n[i]   = idx+1;
+      markers.d[i]   = 1.+inc[i]*(values_.size()-1);
+      markers.inc[i] = inc[i];
+    }
+  }
+  std::vector<double>().swap(values_);
+  sketched_=true;
+}
+
+void
+ToyQuantiles::update(Markers& m, double x)
+{
+  // find cell k with q[k]<=x<q[k+1] and adjust extreme values
+  int k;
+  if(x<m.q[0]){ m.q[0]=x; k=0; }
+  else if(x>=m.q[4]){ m.q[4]=x; k=3; }
+  else{ for(k=0; k<3; ++k){ if(x<m.q[k+1]){ break; } } }
+  for(int i=k+1; i<5; ++i){ m.n[i]+=1.; }
+  for(int i=0  ; i<5; ++i){ m.d[i]+=m.inc[i]; }
+  // adjust the heights of the three central markers if necessary
+  for(int i=1; i<4; ++i){
+    double delta = m.d[i]-m.n[i];
+    if((delta>=1. && m.n[i+1]-m.n[i]>1.) || (delta<=-1. && m.n[i-1]-m.n[i]<-1.)){
+      int s = delta>0 ? 1 : -1;
+      // piecewise parabolic prediction
+      double q = m.q[i]+s/(m.n[i+1]-m.n[i-1])*((m.n[i]-m.n[i-1]+s)*(m.q[i+1]-m.q[i])/(m.n[i+1]-m.n[i])+(m.n[i+1]-m.n[i]-s)*(m.q[i]-m.q[i-1])/(m.n[i]-m.n[i-1]));
+      if(!(m.q[i-1]<q && q<m.q[i+1])){
+	// fall back to linear prediction
+	q = m.q[i]+s*(m.q[i+s]-m.q[i])/(m.n[i+s]-m.n[i]);
+      }
+      m.q[i]=q; m.n[i]+=s;
+    }
+  }
+}
+
+void
+ToyQuantiles::select() const
+{
+  // determine the indices in ascending order, such that each selection
+  // only needs to search the part of the vector above the previous one
+  std::vector<std::pair<unsigned int, unsigned int> > indices;
+  for(unsigned int iprob=0; iprob<probs_.size(); ++iprob){
+    unsigned int idx = (unsigned int)(probs_[iprob]*values_.size());
+    indices.push_back(std::make_pair(idx<values_.size() ? idx : values_.size()-1, iprob));
+  }
+  std::sort(indices.begin(), indices.end());
+  quantiles_.resize(probs_.size());
+  std::vector<double>::iterator first = values_.begin();
+  for(std::vector<std::pair<unsigned int, unsigned int> >::const_iterator idx=indices.begin(); idx!=indices.end(); ++idx){
+    std::vector<double>::iterator nth = values_.begin()+idx->first;
+    if(nth>=first){
+      std::nth_element(first, nth, values_.end());
+      first = nth+1;
+    }
+    quantiles_[idx->second] = *nth;
+  }
+  selected_=true;
+}
+
+double
+ToyQuantiles::quantile(double prob) const
+{
+  if(n_==0){
+    return -1.;
+  }
+  for(unsigned int iprob=0; iprob<probs_.size(); ++iprob){
+    if(probs_[iprob]==prob){
+      if(sketched_){
+	return markers_[iprob].q[2];
+      }
+      if(!selected_){
+	select();
+      }
+      return quantiles_[iprob];
+    }
+  }
+  return -1.;
+}
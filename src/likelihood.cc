@@ -31,11 +31,11 @@ PlotLimits::plotMassScan(TCanvas& canv, TGraph* nll)
   //CMSPrelim(dataset_.c_str(), "", 0.145, 0.835);
   // write to file  
   if(png_){
-    canv.Print(TString::Format("%s-%s.png", output_.c_str(), label_.c_str()));
+    printCanvas(canv, TString::Format("%s-%s.png", output_.c_str(), label_.c_str()));
   }
   if(pdf_){
-    canv.Print(TString::Format("%s-%s.pdf", output_.c_str(), label_.c_str()));
-    canv.Print(TString::Format("%s-%s.eps", output_.c_str(), label_.c_str()));
+    printCanvas(canv, TString::Format("%s-%s.pdf", output_.c_str(), label_.c_str()));
+    printCanvas(canv, TString::Format("%s-%s.eps", output_.c_str(), label_.c_str()));
   }
   if(txt_){
     TString path;
@@ -44,13 +44,8 @@ PlotLimits::plotMassScan(TCanvas& canv, TGraph* nll)
     print(path, modified, modified, "tex"); 
   }
   if(root_){
-    TFile* output = new TFile("likelihood-mass-scan.root", "update");
-    if(!output->cd(output_.c_str())){
-	output->mkdir(output_.c_str());
-	output->cd(output_.c_str());
-    }
-    modified->Write("mass_scan");
-    output->Close();
+    std::string output("likelihood-mass-scan.root");
+    OutputWriter::instance().write(output, output_, modified, "mass_scan");
   }
   return;
 }
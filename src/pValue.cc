@@ -59,11 +59,11 @@ PlotLimits::plotPValue(TCanvas& canv, TGraphAsymmErrors* innerBand, TGraphAsymmE
 
   // write results to files
   if(png_){
-    canv.Print(std::string(output_).append("_").append(label_).append(".png").c_str());
+    printCanvas(canv, std::string(output_).append("_").append(label_).append(".png").c_str());
   }
   if(pdf_){
-    canv.Print(std::string(output_).append("_").append(label_).append(".pdf").c_str());
-    canv.Print(std::string(output_).append("_").append(label_).append(".eps").c_str());
+    printCanvas(canv, std::string(output_).append("_").append(label_).append(".pdf").c_str());
+    printCanvas(canv, std::string(output_).append("_").append(label_).append(".eps").c_str());
   }
   if(txt_){
     print(std::string(output_).append("_").append(label_).c_str(), expected, observed, "txt");
@@ -72,16 +72,11 @@ PlotLimits::plotPValue(TCanvas& canv, TGraphAsymmErrors* innerBand, TGraphAsymmE
     if(innerBand && outerBand) print(std::string(output_).append("_").append(label_).c_str(), outerBand, innerBand, expected, observed, "tex");
   }
   if(root_){
-    TFile* output = new TFile(std::string("p-value-").append(label_).append(".root").c_str(), "update");
-    if(!output->cd(output_.c_str())){
-      output->mkdir(output_.c_str());
-      output->cd(output_.c_str());
-    }
-    if(expected){ expected->Write("expected");}
-    if(observed){ observed->Write("observed");}
-    if(innerBand){ innerBand->Write("innerBand" );}
-    if(outerBand){ outerBand->Write("outerBand" );}
-    output->Close();
+    std::string output(std::string("p-value-").append(label_).append(".root"));
+    if(expected){ OutputWriter::instance().write(output, output_, expected, "expected");}
+    if(observed){ OutputWriter::instance().write(output, output_, observed, "observed");}
+    if(innerBand){ OutputWriter::instance().write(output, output_, innerBand, "innerBand");}
+    if(outerBand){ OutputWriter::instance().write(output, output_, outerBand, "outerBand");}
   }
   return;
 }